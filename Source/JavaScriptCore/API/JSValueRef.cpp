@@ -51,6 +51,15 @@
 
 using namespace JSC;
 
+// On 64-bit platforms a JSValueRef is the encoded JSValue itself, so creating an immediate or
+// testing a value's tag bits does not touch the heap and needs no APIEntryShim. On 32-bit
+// platforms immediates are boxed in a JSAPIValueWrapper cell, so the VM must still be entered.
+#if USE(JSVALUE32_64)
+#define IMMEDIATE_VALUE_API_ENTRY_SHIM(exec) APIEntryShim entryShim(exec)
+#else
+#define IMMEDIATE_VALUE_API_ENTRY_SHIM(exec) UNUSED_PARAM(exec)
+#endif
+
 #if PLATFORM(MAC)
 static bool evernoteHackNeeded()
 {
@@ -94,7 +103,7 @@ bool JSValueIsUndefined(JSContextRef ctx, JSValueRef value)
         return false;
     }
     ExecState* exec = toJS(ctx);
-    APIEntryShim entryShim(exec);
+    IMMEDIATE_VALUE_API_ENTRY_SHIM(exec);
 
     JSValue jsValue = toJS(exec, value);
     return jsValue.isUndefined();
@@ -107,7 +116,7 @@ bool JSValueIsNull(JSContextRef ctx, JSValueRef value)
         return false;
     }
     ExecState* exec = toJS(ctx);
-    APIEntryShim entryShim(exec);
+    IMMEDIATE_VALUE_API_ENTRY_SHIM(exec);
 
     JSValue jsValue = toJS(exec, value);
     return jsValue.isNull();
@@ -120,7 +129,7 @@ bool JSValueIsBoolean(JSContextRef ctx, JSValueRef value)
         return false;
     }
     ExecState* exec = toJS(ctx);
-    APIEntryShim entryShim(exec);
+    IMMEDIATE_VALUE_API_ENTRY_SHIM(exec);
 
     JSValue jsValue = toJS(exec, value);
     return jsValue.isBoolean();
@@ -133,7 +142,7 @@ bool JSValueIsNumber(JSContextRef ctx, JSValueRef value)
         return false;
     }
     ExecState* exec = toJS(ctx);
-    APIEntryShim entryShim(exec);
+    IMMEDIATE_VALUE_API_ENTRY_SHIM(exec);
 
     JSValue jsValue = toJS(exec, value);
     return jsValue.isNumber();
@@ -255,7 +264,7 @@ JSValueRef JSValueMakeUndefined(JSContextRef ctx)
         return 0;
     }
     ExecState* exec = toJS(ctx);
-    APIEntryShim entryShim(exec);
+    IMMEDIATE_VALUE_API_ENTRY_SHIM(exec);
 
     return toRef(exec, jsUndefined());
 }
@@ -267,7 +276,7 @@ JSValueRef JSValueMakeNull(JSContextRef ctx)
         return 0;
     }
     ExecState* exec = toJS(ctx);
-    APIEntryShim entryShim(exec);
+    IMMEDIATE_VALUE_API_ENTRY_SHIM(exec);
 
     return toRef(exec, jsNull());
 }
@@ -279,7 +288,7 @@ JSValueRef JSValueMakeBoolean(JSContextRef ctx, bool value)
         return 0;
     }
     ExecState* exec = toJS(ctx);
-    APIEntryShim entryShim(exec);
+    IMMEDIATE_VALUE_API_ENTRY_SHIM(exec);
 
     return toRef(exec, jsBoolean(value));
 }
@@ -291,7 +300,7 @@ JSValueRef JSValueMakeNumber(JSContextRef ctx, double value)
         return 0;
     }
     ExecState* exec = toJS(ctx);
-    APIEntryShim entryShim(exec);
+    IMMEDIATE_VALUE_API_ENTRY_SHIM(exec);
 
     // Our JSValue representation relies on a standard bit pattern for NaN. NaNs
     // generated internally to JavaScriptCore naturally have that representation,
@@ -373,6 +382,11 @@ double JSValueToNumber(JSContextRef ctx, JSValueRef value, JSValueRef* exception
         return QNaN;
     }
     ExecState* exec = toJS(ctx);
+#if USE(JSVALUE64)
+    JSValue immediate = toJS(exec, value);
+    if (immediate.isNumber())
+        return immediate.asNumber();
+#endif
     APIEntryShim entryShim(exec);
 
     JSValue jsValue = toJS(exec, value);
@@ -164,6 +164,7 @@ private:
     
     // Handle calls. This resolves issues surrounding inlining and intrinsics.
     void handleCall(Interpreter*, Instruction* currentInstruction, NodeType op, CodeSpecializationKind);
+    FunctionExecutable* knownExecutableForCallee(Node*, CodeSpecializationKind);
     void emitFunctionChecks(const CallLinkStatus&, Node* callTarget, int registerOffset, CodeSpecializationKind);
     void emitArgumentPhantoms(int registerOffset, int argumentCountIncludingThis, CodeSpecializationKind);
     // Handle inlining. Return true if it succeeded, false if we need to plant a call.
@@ -1148,7 +1149,14 @@ void ByteCodeParser::handleCall(Interpreter* interpreter, Instruction* currentIn
 
     if (m_graph.isConstant(callTarget))
         callLinkStatus = CallLinkStatus(m_graph.valueOfJSConstant(callTarget)).setIsProved(true);
-    else {
+    else if (FunctionExecutable* executable = knownExecutableForCallee(callTarget, kind)) {
+        // The callee is a closure created in this compilation unit, so we know its
+        // executable without having to look at profiling. This lets us inline callbacks
+        // passed to an inlined function even if the callback's call site has seen many
+        // different functions.
+        callLinkStatus = CallLinkStatus(
+            executable, m_codeBlock->globalObject()->functionStructure()).setIsProved(true);
+    } else {
         callLinkStatus = CallLinkStatus::computeFor(m_inlineStackTop->m_profiledBlock, m_currentIndex);
         callLinkStatus.setHasBadFunctionExitSite(m_inlineStackTop->m_exitProfile.hasExitSite(m_currentIndex, BadFunction));
         callLinkStatus.setHasBadCacheExitSite(m_inlineStackTop->m_exitProfile.hasExitSite(m_currentIndex, BadCache));
@@ -1220,6 +1228,26 @@ void ByteCodeParser::handleCall(Interpreter* interpreter, Instruction* currentIn
     addCall(interpreter, currentInstruction, op);
 }
 
+FunctionExecutable* ByteCodeParser::knownExecutableForCallee(Node* callTarget, CodeSpecializationKind kind)
+{
+    // We only know how to inline closure calls, not closure constructs.
+    if (kind != CodeForCall)
+        return 0;
+    
+    // Function creation nodes only ever appear in the machine code block, since we
+    // refuse to inline code blocks that use op_new_func or op_new_func_exp. NewFunction
+    // may return a previously created function, so we only trust the forms that are
+    // guaranteed to produce a fresh closure.
+    switch (callTarget->op()) {
+    case NewFunctionNoCheck:
+        return m_codeBlock->functionDecl(callTarget->functionDeclIndex());
+    case NewFunctionExpression:
+        return m_codeBlock->functionExpr(callTarget->functionExprIndex());
+    default:
+        return 0;
+    }
+}
+
 void ByteCodeParser::emitFunctionChecks(const CallLinkStatus& callLinkStatus, Node* callTarget, int registerOffset, CodeSpecializationKind kind)
 {
     Node* thisArgument;
@@ -65,6 +65,13 @@ namespace JSC { namespace DFG {
 //
 // All named values must be given a hint that is greater than Min and
 // less than Max.
+//
+// Where several named registers share the lowest hint we spill the one
+// that was least recently retained or locked. Values that have not been
+// touched for a while are the least likely to be needed by the next few
+// nodes, so this approximates spilling the value with the furthest next
+// use, and keeps loop-carried values that are used on every iteration in
+// registers for longer.
 template<class BankInfo>
 class RegisterBank {
     typedef typename BankInfo::RegisterType RegID;
@@ -75,6 +82,7 @@ class RegisterBank {
 
 public:
     RegisterBank()
+        : m_clock(0)
     {
     }
 
@@ -108,14 +116,11 @@ public:
     {
         uint32_t currentLowest = NUM_REGS;
         SpillHint currentSpillOrder = SpillHintInvalid;
+        uint32_t currentLastUse = 0;
 
-        // This loop is broken into two halves, looping from the last allocated
-        // register (the register returned last time this method was called) to
-        // the maximum register value, then from 0 to the last allocated.
-        // This implements a simple round-robin like approach to try to reduce
-        // thrash, and minimize time spent scanning locked registers in allocation.
         // If a unlocked and unnamed register is found return it immediately.
-        // Otherwise, find the first unlocked register with the lowest spillOrder.
+        // Otherwise, find the unlocked register with the lowest spillOrder,
+        // breaking ties in favour of the register least recently used.
         for (uint32_t i = 0 ; i < NUM_REGS; ++i) {
             // (1) If the current register is locked, it is not a candidate.
             if (m_data[i].lockCount)
@@ -126,8 +131,10 @@ public:
                 return allocateInternal(i, spillMe);
             // If this register is better (has a lower spill order value) than any prior
             // candidate, then record it.
-            if (spillOrder < currentSpillOrder) {
+            if (spillOrder < currentSpillOrder
+                || (spillOrder == currentSpillOrder && m_data[i].lastUse < currentLastUse)) {
                 currentSpillOrder = spillOrder;
+                currentLastUse = m_data[i].lastUse;
                 currentLowest = i;
             }
         }
@@ -170,6 +177,7 @@ public:
 
         m_data[index].name = name;
         m_data[index].spillOrder = spillOrder;
+        m_data[index].lastUse = ++m_clock;
     }
     void release(RegID reg)
     {
@@ -184,6 +192,7 @@ public:
         ASSERT(index < NUM_REGS);
         ++m_data[index].lockCount;
         ASSERT(m_data[index].lockCount);
+        m_data[index].lastUse = ++m_clock;
     }
     void unlock(RegID reg)
     {
@@ -340,22 +349,27 @@ private:
     //
     // This structure provides information for an individual machine register
     // being managed by the RegisterBank. For each register we track a lock
-    // count, name and spillOrder hint.
+    // count, name and spillOrder hint, plus the time it was last retained or
+    // locked, which is used to pick between equally cheap spill candidates.
     struct MapEntry {
         MapEntry()
             : name(InvalidVirtualRegister)
             , spillOrder(SpillHintInvalid)
             , lockCount(0)
+            , lastUse(0)
         {
         }
 
         VirtualRegister name;
         SpillHint spillOrder;
         uint32_t lockCount;
+        uint32_t lastUse;
     };
 
     // Holds the current status of all registers.
     MapEntry m_data[NUM_REGS];
+    // Monotonic counter used to timestamp register uses.
+    uint32_t m_clock;
 };
 
 } } // namespace JSC::DFG
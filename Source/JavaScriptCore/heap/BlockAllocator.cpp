@@ -43,21 +43,22 @@ BlockAllocator::BlockAllocator()
     , m_numberOfEmptyRegions(0)
     , m_isCurrentlyAllocating(false)
     , m_blockFreeingThreadShouldQuit(false)
-    , m_blockFreeingThread(createThread(blockFreeingThreadStartFunc, this, "JavaScriptCore::BlockFree"))
+    , m_blockFreeingThread(0)
 {
-    RELEASE_ASSERT(m_blockFreeingThread);
     m_regionLock.Init();
 }
 
 BlockAllocator::~BlockAllocator()
 {
     releaseFreeRegions();
-    {
-        MutexLocker locker(m_emptyRegionConditionLock);
-        m_blockFreeingThreadShouldQuit = true;
-        m_emptyRegionCondition.broadcast();
+    if (m_blockFreeingThread) {
+        {
+            MutexLocker locker(m_emptyRegionConditionLock);
+            m_blockFreeingThreadShouldQuit = true;
+            m_emptyRegionCondition.broadcast();
+        }
+        waitForThreadCompletion(m_blockFreeingThread);
     }
-    waitForThreadCompletion(m_blockFreeingThread);
     ASSERT(allRegionSetsAreEmpty());
     ASSERT(m_emptyRegions.isEmpty());
 }
@@ -110,6 +111,21 @@ void BlockAllocator::waitForRelativeTime(double relative)
     waitForRelativeTimeWhileHoldingLock(relative);
 }
 
+void BlockAllocator::wakeBlockFreeingThread()
+{
+    MutexLocker locker(m_emptyRegionConditionLock);
+
+    // The block freeing thread is only started once there is an empty region for it to
+    // scavenge, so short-lived VMs (e.g. those of workers) never create and join it.
+    if (!m_blockFreeingThread) {
+        m_blockFreeingThread = createThread(blockFreeingThreadStartFunc, this, "JavaScriptCore::BlockFree");
+        RELEASE_ASSERT(m_blockFreeingThread);
+        return;
+    }
+
+    m_emptyRegionCondition.signal();
+}
+
 void BlockAllocator::blockFreeingThreadStartFunc(void* blockAllocator)
 {
     static_cast<BlockAllocator*>(blockAllocator)->blockFreeingThreadMain();
@@ -62,6 +62,7 @@ private:
     void waitForRelativeTimeWhileHoldingLock(double relative);
     void waitForRelativeTime(double relative);
 
+    void wakeBlockFreeingThread();
     void blockFreeingThreadMain();
     static void blockFreeingThreadStartFunc(void* heap);
 
@@ -196,10 +197,8 @@ inline void BlockAllocator::deallocate(T* block)
         }
     }
 
-    if (shouldWakeBlockFreeingThread) {
-        MutexLocker mutexLocker(m_emptyRegionConditionLock);
-        m_emptyRegionCondition.signal();
-    }
+    if (shouldWakeBlockFreeingThread)
+        wakeBlockFreeingThread();
 }
 
 template<typename T>
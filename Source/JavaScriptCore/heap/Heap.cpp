@@ -761,6 +761,11 @@ void Heap::collect(SweepToggle sweepToggle)
         m_vm->clearSourceProviderCaches();
     }
 
+    {
+        GCPHASE(ClearPropertyLookupCache);
+        m_vm->propertyLookupCache.clear();
+    }
+
     if (sweepToggle == DoSweep) {
         SamplingRegion samplingRegion("Garbage Collection: Sweeping");
         GCPHASE(Sweeping);
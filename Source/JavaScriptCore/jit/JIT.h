@@ -398,6 +398,12 @@ namespace JSC {
             return jit.privateCompilePatchGetArrayLength(returnAddress);
         }
 
+        static void compilePatchGetTypedArrayLength(VM* vm, CodeBlock* codeBlock, ReturnAddressPtr returnAddress, const TypedArrayDescriptor& descriptor)
+        {
+            JIT jit(vm, codeBlock);
+            return jit.privateCompilePatchGetTypedArrayLength(returnAddress, descriptor);
+        }
+
         static void linkFor(JSFunction* callee, CodeBlock* callerCodeBlock, CodeBlock* calleeCodeBlock, CodePtr, CallLinkInfo*, VM*, CodeSpecializationKind);
         static void linkSlowCall(CodeBlock* callerCodeBlock, CallLinkInfo*);
 
@@ -424,6 +430,7 @@ namespace JSC {
         Label privateCompileCTINativeCall(VM*, bool isConstruct = false);
         CodeRef privateCompileCTINativeCall(VM*, NativeFunction);
         void privateCompilePatchGetArrayLength(ReturnAddressPtr returnAddress);
+        void privateCompilePatchGetTypedArrayLength(ReturnAddressPtr returnAddress, const TypedArrayDescriptor&);
 
         static bool isDirectPutById(StructureStubInfo*);
 
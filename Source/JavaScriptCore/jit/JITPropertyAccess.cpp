@@ -841,6 +841,49 @@ void JIT::privateCompilePatchGetArrayLength(ReturnAddressPtr returnAddress)
     repatchBuffer.relinkCallerToFunction(returnAddress, FunctionPtr(cti_op_get_by_id_array_fail));
 }
 
+void JIT::privateCompilePatchGetTypedArrayLength(ReturnAddressPtr returnAddress, const TypedArrayDescriptor& descriptor)
+{
+    StructureStubInfo* stubInfo = &m_codeBlock->getStubInfo(returnAddress);
+
+    // Check eax is a typed array of the expected class. The length is a read-only own
+    // property of every typed array, so it cannot be shadowed.
+    loadPtr(Address(regT0, JSCell::structureOffset()), regT2);
+    Jump failureCases1 = branchPtr(NotEqual, Address(regT2, Structure::classInfoOffset()), TrustedImmPtr(descriptor.m_classInfo));
+
+    // Checks out okay! - get the length from the cell
+    load32(Address(regT0, descriptor.m_lengthOffset), regT2);
+    Jump failureCases2 = branch32(LessThan, regT2, TrustedImm32(0));
+
+    emitFastArithIntToImmNoCheck(regT2, regT0);
+    Jump success = jump();
+
+    LinkBuffer patchBuffer(*m_vm, this, m_codeBlock);
+
+    // Use the patch information to link the failure cases back to the original slow case routine.
+    CodeLocationLabel slowCaseBegin = stubInfo->callReturnLocation.labelAtOffset(-stubInfo->patch.baseline.u.get.coldPathBegin);
+    patchBuffer.link(failureCases1, slowCaseBegin);
+    patchBuffer.link(failureCases2, slowCaseBegin);
+
+    // On success return back to the hot patch code, at a point it will perform the store to dest for us.
+    patchBuffer.link(success, stubInfo->hotPathBegin.labelAtOffset(stubInfo->patch.baseline.u.get.putResult));
+
+    // Track the stub we have created so that it will be deleted later.
+    stubInfo->stubRoutine = FINALIZE_CODE_FOR_STUB(
+        patchBuffer,
+        ("Baseline JIT get_by_id typed array length stub for %s, return point %p",
+            toCString(*m_codeBlock).data(),
+            stubInfo->hotPathBegin.labelAtOffset(
+                stubInfo->patch.baseline.u.get.putResult).executableAddress()));
+
+    // Finally patch the jump to slow case back in the hot path to jump here instead.
+    CodeLocationJump jumpLocation = stubInfo->hotPathBegin.jumpAtOffset(stubInfo->patch.baseline.u.get.structureCheck);
+    RepatchBuffer repatchBuffer(m_codeBlock);
+    repatchBuffer.relink(jumpLocation, CodeLocationLabel(stubInfo->stubRoutine->code().code()));
+
+    // We don't want to patch more than once - in future go to cti_op_get_by_id_array_fail.
+    repatchBuffer.relinkCallerToFunction(returnAddress, FunctionPtr(cti_op_get_by_id_array_fail));
+}
+
 void JIT::privateCompileGetByIdProto(StructureStubInfo* stubInfo, Structure* structure, Structure* prototypeStructure, const Identifier& ident, const PropertySlot& slot, PropertyOffset cachedOffset, ReturnAddressPtr returnAddress, CallFrame* callFrame)
 {
     // The prototype object definitely exists (if this stub exists the CodeBlock is referencing a Structure that is
@@ -994,6 +994,13 @@ NEVER_INLINE static void tryCacheGetByID(CallFrame* callFrame, CodeBlock* codeBl
         JIT::compilePatchGetArrayLength(callFrame->scope()->vm(), codeBlock, returnAddress);
         return;
     }
+
+    TypedArrayType typedArrayType = baseValue.asCell()->classInfo()->typedArrayStorageType;
+    if (typedArrayType != TypedArrayNone && propertyName == callFrame->propertyNames().length) {
+        // A typed array cell can only exist once its class has registered a descriptor with the VM.
+        JIT::compilePatchGetTypedArrayLength(vm, codeBlock, returnAddress, *vm->typedArrayDescriptor(typedArrayType));
+        return;
+    }
     
     if (isJSString(baseValue) && propertyName == callFrame->propertyNames().length) {
         // The tradeoff of compiling an patched inline string length access routine does not seem
@@ -2557,7 +2564,7 @@ static JSValue getByVal(
     CallFrame* callFrame, JSValue baseValue, JSValue subscript, ReturnAddressPtr returnAddress)
 {
     if (LIKELY(baseValue.isCell() && subscript.isString())) {
-        if (JSValue result = baseValue.asCell()->fastGetOwnProperty(callFrame, asString(subscript)->value(callFrame)))
+        if (JSValue result = baseValue.asCell()->fastGetOwnProperty(callFrame, asString(subscript)))
             return result;
     }
 
@@ -2573,7 +2580,7 @@ static JSValue getByVal(
     if (isName(subscript))
         return baseValue.get(callFrame, jsCast<NameInstance*>(subscript.asCell())->privateName());
 
-    Identifier property(callFrame, subscript.toString(callFrame)->value(callFrame));
+    Identifier property = subscript.toString(callFrame)->toIdentifier(callFrame);
     return baseValue.get(callFrame, property);
 }
 
@@ -2662,7 +2669,7 @@ DEFINE_STUB_FUNCTION(EncodedJSValue, op_get_by_val_string)
     } else if (isName(subscript))
         result = baseValue.get(callFrame, jsCast<NameInstance*>(subscript.asCell())->privateName());
     else {
-        Identifier property(callFrame, subscript.toString(callFrame)->value(callFrame));
+        Identifier property = subscript.toString(callFrame)->toIdentifier(callFrame);
         result = baseValue.get(callFrame, property);
     }
     
@@ -2702,7 +2709,7 @@ static void putByVal(CallFrame* callFrame, JSValue baseValue, JSValue subscript,
         PutPropertySlot slot(callFrame->codeBlock()->isStrictMode());
         baseValue.put(callFrame, jsCast<NameInstance*>(subscript.asCell())->privateName(), value, slot);
     } else {
-        Identifier property(callFrame, subscript.toString(callFrame)->value(callFrame));
+        Identifier property = subscript.toString(callFrame)->toIdentifier(callFrame);
         if (!callFrame->vm().exception) { // Don't put to an object if toString threw an exception.
             PutPropertySlot slot(callFrame->codeBlock()->isStrictMode());
             baseValue.put(callFrame, property, value, slot);
@@ -3389,7 +3396,7 @@ DEFINE_STUB_FUNCTION(EncodedJSValue, op_in)
     if (isName(propName))
         return JSValue::encode(jsBoolean(baseObj->hasProperty(callFrame, jsCast<NameInstance*>(propName.asCell())->privateName())));
 
-    Identifier property(callFrame, propName.toString(callFrame)->value(callFrame));
+    Identifier property = propName.toString(callFrame)->toIdentifier(callFrame);
     CHECK_FOR_EXCEPTION();
     return JSValue::encode(jsBoolean(baseObj->hasProperty(callFrame, property)));
 }
@@ -3491,7 +3498,7 @@ DEFINE_STUB_FUNCTION(EncodedJSValue, op_del_by_val)
         result = baseObj->methodTable()->deleteProperty(baseObj, callFrame, jsCast<NameInstance*>(subscript.asCell())->privateName());
     else {
         CHECK_FOR_EXCEPTION();
-        Identifier property(callFrame, subscript.toString(callFrame)->value(callFrame));
+        Identifier property = subscript.toString(callFrame)->toIdentifier(callFrame);
         CHECK_FOR_EXCEPTION();
         result = baseObj->methodTable()->deleteProperty(baseObj, callFrame, property);
     }
@@ -33,6 +33,7 @@
 #include "Instruction.h"
 #include "LLIntCLoop.h"
 #include "Opcode.h"
+#include "TypedArrayDescriptor.h"
 
 namespace JSC { namespace LLInt {
 
@@ -104,6 +105,15 @@ void Data::performAssertions(VM& vm)
 #endif
     ASSERT(StringType == 5);
     ASSERT(ObjectType == 17);
+    ASSERT(TypedArrayInt8 == 1);
+    ASSERT(TypedArrayInt16 == 2);
+    ASSERT(TypedArrayInt32 == 3);
+    ASSERT(TypedArrayUint8 == 4);
+    ASSERT(TypedArrayUint8Clamped == 5);
+    ASSERT(TypedArrayUint16 == 6);
+    ASSERT(TypedArrayUint32 == 7);
+    ASSERT(TypedArrayFloat32 == 8);
+    ASSERT(TypedArrayFloat64 == 9);
     ASSERT(MasqueradesAsUndefined == 1);
     ASSERT(ImplementsHasInstance == 2);
     ASSERT(ImplementsDefaultHasInstance == 8);
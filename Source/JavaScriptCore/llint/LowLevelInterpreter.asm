@@ -107,6 +107,17 @@ const SlowPutArrayStorageShape = 30
 const StringType = 5
 const ObjectType = 17
 
+# Typed array storage types, from TypedArrayDescriptor.h.
+const TypedArrayInt8 = 1
+const TypedArrayInt16 = 2
+const TypedArrayInt32 = 3
+const TypedArrayUint8 = 4
+const TypedArrayUint8Clamped = 5
+const TypedArrayUint16 = 6
+const TypedArrayUint32 = 7
+const TypedArrayFloat32 = 8
+const TypedArrayFloat64 = 9
+
 # Type flags constants.
 const MasqueradesAsUndefined = 1
 const ImplementsHasInstance = 2
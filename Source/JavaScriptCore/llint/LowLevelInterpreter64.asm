@@ -874,6 +874,30 @@ _llint_op_get_by_id_out_of_line:
     getById(withOutOfLineStorage)
 
 
+# Typed arrays are WebCore wrappers without a butterfly. Their ClassInfo names the
+# element type, and each class registers the offsets of its length and storage
+# pointer with the VM as a TypedArrayDescriptor.
+macro loadTypedArrayType(cell, type)
+    loadp JSCell::m_structure[cell], type
+    loadp Structure::m_classInfo[type], type
+    loadi ClassInfo::typedArrayStorageType[type], type
+end
+
+macro loadTypedArrayStorage(descriptor, vm, base, index, storage, outOfBounds)
+    loadp descriptor + TypedArrayDescriptor::m_lengthOffset[vm], storage
+    biaeq index, [base, storage], outOfBounds
+    loadp descriptor + TypedArrayDescriptor::m_storageOffset[vm], storage
+    loadp [base, storage], storage
+end
+
+macro typedArrayGetLength(type, descriptor)
+    bineq t2, type, .notThisType
+    loadp descriptor + TypedArrayDescriptor::m_lengthOffset[t0], t2
+    loadi [t3, t2], t0
+    jmp .opGetArrayLengthDone
+.notThisType:
+end
+
 _llint_op_get_array_length:
     traceExecution()
     loadisFromInstruction(2, t0)
@@ -881,18 +905,32 @@ _llint_op_get_array_length:
     loadConstantOrVariableCell(t0, t3, .opGetArrayLengthSlow)
     loadp JSCell::m_structure[t3], t2
     arrayProfile(t2, t1, t0)
-    btiz t2, IsArray, .opGetArrayLengthSlow
+    btiz t2, IsArray, .opGetArrayLengthNotArray
     btiz t2, IndexingShapeMask, .opGetArrayLengthSlow
-    loadisFromInstruction(1, t1)
-    loadpFromInstruction(8, t2)
     loadp JSObject::m_butterfly[t3], t0
     loadi -sizeof IndexingHeader + IndexingHeader::u.lengths.publicLength[t0], t0
+.opGetArrayLengthDone:
     bilt t0, 0, .opGetArrayLengthSlow
+    loadisFromInstruction(1, t1)
+    loadpFromInstruction(8, t2)
     orq tagTypeNumber, t0
     valueProfile(t0, t2)
     storeq t0, [cfr, t1, 8]
     dispatch(9)
 
+.opGetArrayLengthNotArray:
+    loadTypedArrayType(t3, t2)
+    loadp JITStackFrame::vm[sp], t0
+    typedArrayGetLength(TypedArrayInt8, VM::m_int8ArrayDescriptor)
+    typedArrayGetLength(TypedArrayInt16, VM::m_int16ArrayDescriptor)
+    typedArrayGetLength(TypedArrayInt32, VM::m_int32ArrayDescriptor)
+    typedArrayGetLength(TypedArrayUint8, VM::m_uint8ArrayDescriptor)
+    typedArrayGetLength(TypedArrayUint8Clamped, VM::m_uint8ClampedArrayDescriptor)
+    typedArrayGetLength(TypedArrayUint16, VM::m_uint16ArrayDescriptor)
+    typedArrayGetLength(TypedArrayUint32, VM::m_uint32ArrayDescriptor)
+    typedArrayGetLength(TypedArrayFloat32, VM::m_float32ArrayDescriptor)
+    typedArrayGetLength(TypedArrayFloat64, VM::m_float64ArrayDescriptor)
+
 .opGetArrayLengthSlow:
     callSlowPath(_llint_slow_path_get_by_id)
     dispatch(9)
@@ -1003,6 +1041,14 @@ _llint_op_put_by_id_transition_normal_out_of_line:
     putByIdTransition(structureChainChecks, withOutOfLineStorage)
 
 
+macro typedArrayGetByVal(type, descriptor, loadCallback)
+    bineq t2, type, .notThisType
+    loadTypedArrayStorage(descriptor, t3, t0, t1, t2, .opGetByValOutOfBounds)
+    loadCallback(t2, t1, t2)
+    jmp .opGetByValTypedArrayDone
+.notThisType:
+end
+
 _llint_op_get_by_val:
     traceExecution()
     loadisFromInstruction(2, t2)
@@ -1036,6 +1082,7 @@ _llint_op_get_by_val:
     jmp .opGetByValDone
     
 .opGetByValNotDouble:
+    btiz t2, .opGetByValNoIndexingShape
     subi ArrayStorageShape, t2
     bia t2, SlowPutArrayStorageShape - ArrayStorageShape, .opGetByValSlow
     biaeq t1, -sizeof IndexingHeader + IndexingHeader::u.lengths.vectorLength[t3], .opGetByValOutOfBounds
@@ -1058,6 +1105,61 @@ _llint_op_get_by_val:
     callSlowPath(_llint_slow_path_get_by_val)
     dispatch(6)
 
+.opGetByValNoIndexingShape:
+    loadTypedArrayType(t0, t2)
+    loadp JITStackFrame::vm[sp], t3
+    typedArrayGetByVal(TypedArrayInt8, VM::m_int8ArrayDescriptor,
+        macro (storage, index, result)
+            loadbs [storage, index], result
+            zxi2q result, result
+            orq tagTypeNumber, result
+        end)
+    typedArrayGetByVal(TypedArrayInt16, VM::m_int16ArrayDescriptor,
+        macro (storage, index, result)
+            loadhs [storage, index, 2], result
+            zxi2q result, result
+            orq tagTypeNumber, result
+        end)
+    typedArrayGetByVal(TypedArrayInt32, VM::m_int32ArrayDescriptor,
+        macro (storage, index, result)
+            loadi [storage, index, 4], result
+            orq tagTypeNumber, result
+        end)
+    typedArrayGetByVal(TypedArrayUint8, VM::m_uint8ArrayDescriptor,
+        macro (storage, index, result)
+            loadb [storage, index], result
+            orq tagTypeNumber, result
+        end)
+    typedArrayGetByVal(TypedArrayUint8Clamped, VM::m_uint8ClampedArrayDescriptor,
+        macro (storage, index, result)
+            loadb [storage, index], result
+            orq tagTypeNumber, result
+        end)
+    typedArrayGetByVal(TypedArrayUint16, VM::m_uint16ArrayDescriptor,
+        macro (storage, index, result)
+            loadh [storage, index, 2], result
+            orq tagTypeNumber, result
+        end)
+    typedArrayGetByVal(TypedArrayUint32, VM::m_uint32ArrayDescriptor,
+        macro (storage, index, result)
+            loadi [storage, index, 4], result
+            bilt result, 0, .opGetByValSlow
+            orq tagTypeNumber, result
+        end)
+    typedArrayGetByVal(TypedArrayFloat64, VM::m_float64ArrayDescriptor,
+        macro (storage, index, result)
+            loadd [storage, index, 8], ft0
+            bdnequn ft0, ft0, .opGetByValSlow
+            fd2q ft0, result
+            subq tagTypeNumber, result
+        end)
+    # Float32 elements would need a single-precision load, which offlineasm lacks.
+    jmp .opGetByValSlow
+
+.opGetByValTypedArrayDone:
+    loadisFromInstruction(1, t0)
+    jmp .opGetByValDone
+
 
 _llint_op_get_argument_by_val:
     # FIXME: At some point we should array profile this. Right now it isn't necessary
@@ -1134,6 +1236,16 @@ macro contiguousPutByVal(storeCallback)
     jmp .storeResult
 end
 
+macro typedArrayPutByVal(type, descriptor, storeCallback)
+    bineq t2, type, .notThisType
+    loadTypedArrayStorage(descriptor, t0, t1, t3, t2, .opPutByValOutOfBounds)
+    loadisFromInstruction(3, t0)
+    loadConstantOrVariable(t0, t1)
+    storeCallback(t1, t2, t3)
+    dispatch(5)
+.notThisType:
+end
+
 _llint_op_put_by_val:
     traceExecution()
     loadisFromInstruction(1, t0)
@@ -1180,7 +1292,7 @@ _llint_op_put_by_val:
         end)
 
 .opPutByValNotContiguous:
-    bineq t2, ArrayStorageShape, .opPutByValSlow
+    bineq t2, ArrayStorageShape, .opPutByValNotArrayStorage
     biaeq t3, -sizeof IndexingHeader + IndexingHeader::u.lengths.vectorLength[t0], .opPutByValOutOfBounds
     btqz ArrayStorage::m_vector[t0, t3, 8], .opPutByValArrayStorageEmpty
 .opPutByValArrayStorageStoreResult:
@@ -1210,6 +1322,67 @@ _llint_op_put_by_val:
     callSlowPath(_llint_slow_path_put_by_val)
     dispatch(5)
 
+.opPutByValNotArrayStorage:
+    btinz t2, .opPutByValSlow
+    loadTypedArrayType(t1, t2)
+    loadp JITStackFrame::vm[sp], t0
+    typedArrayPutByVal(TypedArrayInt8, VM::m_int8ArrayDescriptor,
+        macro (value, storage, index)
+            bqb value, tagTypeNumber, .opPutByValSlow
+            storeb value, [storage, index]
+        end)
+    typedArrayPutByVal(TypedArrayInt16, VM::m_int16ArrayDescriptor,
+        macro (value, storage, index)
+            bqb value, tagTypeNumber, .opPutByValSlow
+            storeh value, [storage, index, 2]
+        end)
+    typedArrayPutByVal(TypedArrayInt32, VM::m_int32ArrayDescriptor,
+        macro (value, storage, index)
+            bqb value, tagTypeNumber, .opPutByValSlow
+            storei value, [storage, index, 4]
+        end)
+    typedArrayPutByVal(TypedArrayUint8, VM::m_uint8ArrayDescriptor,
+        macro (value, storage, index)
+            bqb value, tagTypeNumber, .opPutByValSlow
+            storeb value, [storage, index]
+        end)
+    typedArrayPutByVal(TypedArrayUint8Clamped, VM::m_uint8ClampedArrayDescriptor,
+        macro (value, storage, index)
+            bqb value, tagTypeNumber, .opPutByValSlow
+            bilt value, 0, .clampToZero
+            bilteq value, 255, .store
+            move 255, value
+            jmp .store
+        .clampToZero:
+            move 0, value
+        .store:
+            storeb value, [storage, index]
+        end)
+    typedArrayPutByVal(TypedArrayUint16, VM::m_uint16ArrayDescriptor,
+        macro (value, storage, index)
+            bqb value, tagTypeNumber, .opPutByValSlow
+            storeh value, [storage, index, 2]
+        end)
+    typedArrayPutByVal(TypedArrayUint32, VM::m_uint32ArrayDescriptor,
+        macro (value, storage, index)
+            bqb value, tagTypeNumber, .opPutByValSlow
+            storei value, [storage, index, 4]
+        end)
+    typedArrayPutByVal(TypedArrayFloat64, VM::m_float64ArrayDescriptor,
+        macro (value, storage, index)
+            bqb value, tagTypeNumber, .notInt
+            ci2d value, ft0
+            jmp .ready
+        .notInt:
+            btqz value, tagTypeNumber, .opPutByValSlow
+            addp tagTypeNumber, value
+            fq2d value, ft0
+        .ready:
+            stored ft0, [storage, index, 8]
+        end)
+    # Float32 elements would need a single-precision store, which offlineasm lacks.
+    jmp .opPutByValSlow
+
 
 _llint_op_jmp:
     traceExecution()
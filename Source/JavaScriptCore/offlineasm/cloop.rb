@@ -656,7 +656,7 @@ class Instruction
         when "loadhs"
             $asm.putc "#{operands[1].clValue(:int)} = #{operands[0].int16MemRef};"
         when "storeh"
-            $asm.putc "*#{operands[1].uint16MemRef} = #{operands[0].clValue(:int16)};"
+            $asm.putc "#{operands[1].uint16MemRef} = #{operands[0].clValue(:int)};"
         when "loadd"
             $asm.putc "#{operands[1].clValue(:double)} = #{operands[0].dblMemRef};"
         when "stored"
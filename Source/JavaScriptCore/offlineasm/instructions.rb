@@ -56,6 +56,7 @@ MACRO_INSTRUCTIONS =
      "loadhs",
      "storei",
      "storeb",
+     "storeh",
      "loadd",
      "moved",
      "stored",
@@ -815,6 +815,8 @@ class Instruction
             $asm.puts "movswl #{operands[0].x86Operand(:half)}, #{operands[1].x86Operand(:int)}"
         when "storeb"
             $asm.puts "movb #{x86Operands(:byte, :byte)}"
+        when "storeh"
+            $asm.puts "movw #{x86Operands(:half, :half)}"
         when "loadd"
             if useX87
                 $asm.puts "fldl #{operands[0].x86Operand(:double)}"
@@ -626,58 +626,49 @@ static bool attemptFastSort(ExecState* exec, JSObject* thisObj, JSValue function
 
 static bool performSlowSort(ExecState* exec, JSObject* thisObj, unsigned length, JSValue function, CallData& callData, CallType& callType)
 {
-    // "Min" sort. Not the fastest, but definitely less code than heapsort
-    // or quicksort, and much less swapping than bubblesort/insertionsort.
-    for (unsigned i = 0; i < length - 1; ++i) {
-        JSValue iObj = getOrHole(thisObj, exec, i);
+    // Sort the defined values out of line with the same stable merge sort JSArray uses,
+    // then write them back followed by the undefined values, and delete the properties
+    // left over at the end so that holes sort last.
+    Vector<ValueStringPair, 0, UnsafeVectorOverflow> values;
+    exec->heap()->pushTempSortVector(&values);
+
+    unsigned numUndefined = 0;
+    for (unsigned i = 0; i < length; ++i) {
+        JSValue value = getOrHole(thisObj, exec, i);
         if (exec->hadException())
-            return false;
-        unsigned themin = i;
-        JSValue minObj = iObj;
-        for (unsigned j = i + 1; j < length; ++j) {
-            JSValue jObj = getOrHole(thisObj, exec, j);
+            break;
+        if (!value)
+            continue;
+        if (value.isUndefined())
+            ++numUndefined;
+        else
+            values.append(ValueStringPair(value, String()));
+    }
+
+    if (!exec->hadException())
+        mergeSortArrayValues(exec, values, function, callType, callData);
+
+    unsigned index = 0;
+    if (!exec->hadException()) {
+        for (; index < values.size(); ++index) {
+            thisObj->methodTable()->putByIndex(thisObj, exec, index, values[index].first, true);
             if (exec->hadException())
-                return false;
-            double compareResult;
-            if (!jObj)
-                compareResult = 1;
-            else if (!minObj)
-                compareResult = -1;
-            else if (jObj.isUndefined())
-                compareResult = 1; // don't check minObj because there's no need to differentiate == (0) from > (1)
-            else if (minObj.isUndefined())
-                compareResult = -1;
-            else if (callType != CallTypeNone) {
-                MarkedArgumentBuffer l;
-                l.append(jObj);
-                l.append(minObj);
-                compareResult = call(exec, function, callType, callData, jsUndefined(), l).toNumber(exec);
-            } else
-                compareResult = codePointCompareLessThan(jObj.toWTFStringInline(exec), minObj.toWTFStringInline(exec)) ? -1 : 1;
-
-            if (compareResult < 0) {
-                themin = j;
-                minObj = jObj;
-            }
+                break;
         }
-        // Swap themin and i
-        if (themin > i) {
-            if (minObj) {
-                thisObj->methodTable()->putByIndex(thisObj, exec, i, minObj, true);
-                if (exec->hadException())
-                    return false;
-            } else if (!thisObj->methodTable()->deletePropertyByIndex(thisObj, exec, i)) {
-                throwTypeError(exec, "Unable to delete property.");
-                return false;
-            }
-            if (iObj) {
-                thisObj->methodTable()->putByIndex(thisObj, exec, themin, iObj, true);
-                if (exec->hadException())
-                    return false;
-            } else if (!thisObj->methodTable()->deletePropertyByIndex(thisObj, exec, themin)) {
-                throwTypeError(exec, "Unable to delete property.");
-                return false;
-            }
+    }
+    exec->heap()->popTempSortVector(&values);
+    if (exec->hadException())
+        return false;
+
+    for (unsigned i = 0; i < numUndefined; ++i, ++index) {
+        thisObj->methodTable()->putByIndex(thisObj, exec, index, jsUndefined(), true);
+        if (exec->hadException())
+            return false;
+    }
+    for (; index < length; ++index) {
+        if (!thisObj->methodTable()->deletePropertyByIndex(thisObj, exec, index)) {
+            throwTypeError(exec, "Unable to delete property.");
+            return false;
         }
     }
     return true;
@@ -91,7 +91,7 @@ inline bool opIn(ExecState* exec, JSValue propName, JSValue baseVal)
     if (isName(propName))
         return baseObj->hasProperty(exec, jsCast<NameInstance*>(propName.asCell())->privateName());
 
-    Identifier property(exec, propName.toString(exec)->value(exec));
+    Identifier property = propName.toString(exec)->toIdentifier(exec);
     if (exec->vm().exception)
         return false;
     return baseObj->hasProperty(exec, property);
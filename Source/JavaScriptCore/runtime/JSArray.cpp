@@ -34,7 +34,6 @@
 #include "IndexingHeaderInlines.h"
 #include "PropertyNameArray.h"
 #include "Reject.h"
-#include <wtf/AVLTree.h>
 #include <wtf/Assertions.h>
 #include <wtf/OwnPtr.h>
 #include <Operations.h>
@@ -1246,61 +1245,29 @@ void JSArray::sort(ExecState* exec)
     }
 }
 
-struct AVLTreeNodeForArrayCompare {
-    JSValue value;
-
-    // Child pointers.  The high bit of gt is robbed and used as the
-    // balance factor sign.  The high bit of lt is robbed and used as
-    // the magnitude of the balance factor.
-    int32_t gt;
-    int32_t lt;
-};
-
-struct AVLTreeAbstractorForArrayCompare {
-    typedef int32_t handle; // Handle is an index into m_nodes vector.
-    typedef JSValue key;
-    typedef int32_t size;
-
-    Vector<AVLTreeNodeForArrayCompare, 0, UnsafeVectorOverflow> m_nodes;
-    ExecState* m_exec;
-    JSValue m_compareFunction;
-    CallType m_compareCallType;
-    const CallData* m_compareCallData;
-    OwnPtr<CachedCall> m_cachedCall;
-
-    handle get_less(handle h) { return m_nodes[h].lt & 0x7FFFFFFF; }
-    void set_less(handle h, handle lh) { m_nodes[h].lt &= 0x80000000; m_nodes[h].lt |= lh; }
-    handle get_greater(handle h) { return m_nodes[h].gt & 0x7FFFFFFF; }
-    void set_greater(handle h, handle gh) { m_nodes[h].gt &= 0x80000000; m_nodes[h].gt |= gh; }
-
-    int get_balance_factor(handle h)
+class ArraySortComparator {
+public:
+    ArraySortComparator(ExecState* exec, JSValue compareFunction, CallType callType, const CallData& callData)
+        : m_exec(exec)
+        , m_compareFunction(compareFunction)
+        , m_compareCallType(callType)
+        , m_compareCallData(callData)
     {
-        if (m_nodes[h].gt & 0x80000000)
-            return -1;
-        return static_cast<unsigned>(m_nodes[h].lt) >> 31;
+        if (callType == CallTypeJS)
+            m_cachedCall = adoptPtr(new CachedCall(exec, jsCast<JSFunction*>(compareFunction), 2));
     }
 
-    void set_balance_factor(handle h, int bf)
-    {
-        if (bf == 0) {
-            m_nodes[h].lt &= 0x7FFFFFFF;
-            m_nodes[h].gt &= 0x7FFFFFFF;
-        } else {
-            m_nodes[h].lt |= 0x80000000;
-            if (bf < 0)
-                m_nodes[h].gt |= 0x80000000;
-            else
-                m_nodes[h].gt &= 0x7FFFFFFF;
-        }
-    }
-
-    int compare_key_key(key va, key vb)
+    // Returns true if a must be ordered after b. Results that are not greater than
+    // zero, including NaN, leave the two values in their original order.
+    bool isGreater(const ValueStringPair& a, const ValueStringPair& b)
     {
+        JSValue va = a.first;
+        JSValue vb = b.first;
         ASSERT(!va.isUndefined());
         ASSERT(!vb.isUndefined());
 
         if (m_exec->hadException())
-            return 1;
+            return false;
 
         double compareResult;
         if (m_cachedCall) {
@@ -1312,104 +1279,171 @@ struct AVLTreeAbstractorForArrayCompare {
             MarkedArgumentBuffer arguments;
             arguments.append(va);
             arguments.append(vb);
-            compareResult = call(m_exec, m_compareFunction, m_compareCallType, *m_compareCallData, jsUndefined(), arguments).toNumber(m_exec);
+            compareResult = call(m_exec, m_compareFunction, m_compareCallType, m_compareCallData, jsUndefined(), arguments).toNumber(m_exec);
         }
-        return (compareResult < 0) ? -1 : 1; // Not passing equality through, because we need to store all values, even if equivalent.
+        return compareResult > 0;
     }
 
-    int compare_key_node(key k, handle h) { return compare_key_key(k, m_nodes[h].value); }
-    int compare_node_node(handle h1, handle h2) { return compare_key_key(m_nodes[h1].value, m_nodes[h2].value); }
+private:
+    ExecState* m_exec;
+    JSValue m_compareFunction;
+    CallType m_compareCallType;
+    const CallData& m_compareCallData;
+    OwnPtr<CachedCall> m_cachedCall;
+};
 
-    static handle null() { return 0x7FFFFFFF; }
+// Orders values by the string conversions stored alongside them, which is how
+// Array.prototype.sort compares when no compare function is given.
+class ArrayStringSortComparator {
+public:
+    bool isGreater(const ValueStringPair& a, const ValueStringPair& b)
+    {
+        return codePointCompare(a.second, b.second) > 0;
+    }
 };
 
+// Stable bottom-up merge sort. Both buffers must be at least 'size' long; the sorted
+// values end up in 'values'. Adjacent runs that are already in order are copied without
+// being merged, so sorting input that is already sorted only costs n - 1 comparisons.
+template<typename Comparator>
+static void mergeSortForArrayCompare(Comparator& comparator, ValueStringPair* values, ValueStringPair* buffer, size_t size)
+{
+    ValueStringPair* source = values;
+    ValueStringPair* destination = buffer;
+
+    for (size_t width = 1; width < size; width *= 2) {
+        for (size_t left = 0; left < size; left += 2 * width) {
+            size_t middle = std::min(left + width, size);
+            size_t right = std::min(middle + width, size);
+
+            if (middle == right || !comparator.isGreater(source[middle - 1], source[middle])) {
+                for (size_t i = left; i < right; ++i)
+                    destination[i] = source[i];
+                continue;
+            }
+
+            size_t i = left;
+            size_t j = middle;
+            size_t k = left;
+            while (i < middle && j < right) {
+                if (comparator.isGreater(source[i], source[j]))
+                    destination[k++] = source[j++];
+                else
+                    destination[k++] = source[i++];
+            }
+            while (i < middle)
+                destination[k++] = source[i++];
+            while (j < right)
+                destination[k++] = source[j++];
+        }
+        std::swap(source, destination);
+    }
+
+    if (source != values) {
+        for (size_t i = 0; i < size; ++i)
+            values[i] = source[i];
+    }
+}
+
+void mergeSortArrayValues(ExecState* exec, Vector<ValueStringPair, 0, UnsafeVectorOverflow>& values, JSValue compareFunction, CallType callType, const CallData& callData)
+{
+    if (values.isEmpty())
+        return;
+
+    Vector<ValueStringPair, 0, UnsafeVectorOverflow> buffer(values.size());
+    if (!buffer.begin()) {
+        throwOutOfMemoryError(exec);
+        return;
+    }
+    exec->heap()->pushTempSortVector(&buffer);
+
+    if (callType == CallTypeNone) {
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i].second = values[i].first.toWTFStringInline(exec);
+            if (exec->hadException())
+                break;
+        }
+        if (!exec->hadException()) {
+            ArrayStringSortComparator comparator;
+            mergeSortForArrayCompare(comparator, values.begin(), buffer.begin(), values.size());
+        }
+    } else {
+        ArraySortComparator comparator(exec, compareFunction, callType, callData);
+        mergeSortForArrayCompare(comparator, values.begin(), buffer.begin(), values.size());
+    }
+
+    exec->heap()->popTempSortVector(&buffer);
+}
+
 template<IndexingType indexingType>
 void JSArray::sortVector(ExecState* exec, JSValue compareFunction, CallType callType, const CallData& callData)
 {
     ASSERT(!inSparseIndexingMode());
     ASSERT(indexingType == structure()->indexingType());
     
-    // FIXME: This ignores exceptions raised in the compare function or in toNumber.
-        
-    // The maximum tree depth is compiled in - but the caller is clearly up to no good
-    // if a larger array is passed.
-    ASSERT(m_butterfly->publicLength() <= static_cast<unsigned>(std::numeric_limits<int>::max()));
-    if (m_butterfly->publicLength() > static_cast<unsigned>(std::numeric_limits<int>::max()))
-        return;
+    // An exception from the compare function or from toNumber stops the sort early. The
+    // values are still written back in the order reached, and the exception propagates.
         
     unsigned usedVectorLength = relevantLength<indexingType>();
-    unsigned nodeCount = usedVectorLength;
-        
-    if (!nodeCount)
+    if (!usedVectorLength)
         return;
         
-    AVLTree<AVLTreeAbstractorForArrayCompare, 44> tree; // Depth 44 is enough for 2^31 items
-    tree.abstractor().m_exec = exec;
-    tree.abstractor().m_compareFunction = compareFunction;
-    tree.abstractor().m_compareCallType = callType;
-    tree.abstractor().m_compareCallData = &callData;
-    tree.abstractor().m_nodes.grow(nodeCount);
-        
-    if (callType == CallTypeJS)
-        tree.abstractor().m_cachedCall = adoptPtr(new CachedCall(exec, jsCast<JSFunction*>(compareFunction), 2));
-        
-    if (!tree.abstractor().m_nodes.begin()) {
+    // The values are sorted out of line, so that the compare function cannot observe
+    // a partially sorted array. Both buffers are registered with the heap because the
+    // compare function may remove values from the array and then trigger a collection.
+    Vector<ValueStringPair, 0, UnsafeVectorOverflow> values(usedVectorLength);
+    Vector<ValueStringPair, 0, UnsafeVectorOverflow> buffer(usedVectorLength);
+    if (!values.begin() || !buffer.begin()) {
         throwOutOfMemoryError(exec);
         return;
     }
         
-    // FIXME: If the compare function modifies the array, the vector, map, etc. could be modified
-    // right out from under us while we're building the tree here.
-        
     unsigned numDefined = 0;
     unsigned numUndefined = 0;
     
-    // Iterate over the array, ignoring missing values, counting undefined ones, and inserting all other ones into the tree.
-    for (; numDefined < usedVectorLength; ++numDefined) {
-        if (numDefined >= m_butterfly->vectorLength())
-            break;
-        JSValue v = getHolyIndexQuickly(numDefined);
-        if (!v || v.isUndefined())
-            break;
-        tree.abstractor().m_nodes[numDefined].value = v;
-        tree.insert(numDefined);
-    }
-    for (unsigned i = numDefined; i < usedVectorLength; ++i) {
+    // Iterate over the array, ignoring missing values, counting undefined ones, and collecting all other ones.
+    for (unsigned i = 0; i < usedVectorLength; ++i) {
         if (i >= m_butterfly->vectorLength())
             break;
         JSValue v = getHolyIndexQuickly(i);
-        if (v) {
-            if (v.isUndefined())
-                ++numUndefined;
-            else {
-                tree.abstractor().m_nodes[numDefined].value = v;
-                tree.insert(numDefined);
-                ++numDefined;
-            }
-        }
+        if (!v)
+            continue;
+        if (v.isUndefined())
+            ++numUndefined;
+        else
+            values[numDefined++].first = v;
     }
+    values.shrink(numDefined);
+    buffer.shrink(numDefined);
+    
+    Heap::heap(this)->pushTempSortVector(&values);
+    Heap::heap(this)->pushTempSortVector(&buffer);
+    
+    ArraySortComparator comparator(exec, compareFunction, callType, callData);
+    mergeSortForArrayCompare(comparator, values.begin(), buffer.begin(), numDefined);
     
     unsigned newUsedVectorLength = numDefined + numUndefined;
         
     // The array size may have changed. Figure out the new bounds.
     unsigned newestUsedVectorLength = currentRelevantLength();
         
-    unsigned elementsToExtractThreshold = min(min(newestUsedVectorLength, numDefined), static_cast<unsigned>(tree.abstractor().m_nodes.size()));
+    unsigned elementsToExtractThreshold = min(newestUsedVectorLength, numDefined);
     unsigned undefinedElementsThreshold = min(newestUsedVectorLength, newUsedVectorLength);
     unsigned clearElementsThreshold = min(newestUsedVectorLength, usedVectorLength);
         
     // Copy the values back into m_storage.
-    AVLTree<AVLTreeAbstractorForArrayCompare, 44>::Iterator iter;
-    iter.start_iter_least(tree);
     VM& vm = exec->vm();
     for (unsigned i = 0; i < elementsToExtractThreshold; ++i) {
         ASSERT(i < butterfly()->vectorLength());
         if (structure()->indexingType() == ArrayWithDouble)
-            butterfly()->contiguousDouble()[i] = tree.abstractor().m_nodes[*iter].value.asNumber();
+            butterfly()->contiguousDouble()[i] = values[i].first.asNumber();
         else
-            currentIndexingData()[i].set(vm, this, tree.abstractor().m_nodes[*iter].value);
-        ++iter;
+            currentIndexingData()[i].set(vm, this, values[i].first);
     }
+    
+    Heap::heap(this)->popTempSortVector(&buffer);
+    Heap::heap(this)->popTempSortVector(&values);
+    
     // Put undefined values back in.
     switch (structure()->indexingType()) {
     case ArrayWithInt32:
@@ -282,6 +282,11 @@ inline JSArray* asArray(JSValue value)
 inline bool isJSArray(JSCell* cell) { return cell->classInfo() == &JSArray::s_info; }
 inline bool isJSArray(JSValue v) { return v.isCell() && isJSArray(v.asCell()); }
 
+// Stable sort with the ordering of Array.prototype.sort, for objects that cannot be sorted
+// in place. The values must not include holes or undefined, and the caller must register
+// the vector with the heap. Stops early if the compare function or toString throws.
+void mergeSortArrayValues(ExecState*, Vector<ValueStringPair, 0, UnsafeVectorOverflow>&, JSValue compareFunction, CallType, const CallData&);
+
 inline JSArray* constructArray(ExecState* exec, Structure* arrayStructure, const ArgList& values)
 {
     VM& vm = exec->vm();
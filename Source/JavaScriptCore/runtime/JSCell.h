@@ -126,7 +126,7 @@ public:
     // call this function, not its slower virtual counterpart. (For integer
     // property names, we want a similar interface with appropriate optimizations.)
     bool fastGetOwnPropertySlot(ExecState*, PropertyName, PropertySlot&);
-    JSValue fastGetOwnProperty(ExecState*, const String&);
+    JSValue fastGetOwnProperty(ExecState*, JSString*);
 
     static ptrdiff_t structureOffset()
     {
@@ -173,13 +173,16 @@ ALWAYS_INLINE bool JSCell::fastGetOwnPropertySlot(ExecState* exec, PropertyName
 // Fast call to get a property where we may not yet have converted the string to an
 // identifier. The first time we perform a property access with a given string, try
 // performing the property map lookup without forming an identifier. We detect this
-// case by checking whether the hash has yet been set for this string.
-ALWAYS_INLINE JSValue JSCell::fastGetOwnProperty(ExecState* exec, const String& name)
+// case by checking whether the hash has yet been set for this string. After that the
+// string is converted to an identifier in place, so later lookups skip the identifier
+// table.
+ALWAYS_INLINE JSValue JSCell::fastGetOwnProperty(ExecState* exec, JSString* name)
 {
     if (!structure()->typeInfo().overridesGetOwnPropertySlot() && !structure()->hasGetterSetterProperties()) {
-        PropertyOffset offset = name.impl()->hasHash()
-            ? structure()->get(exec->vm(), Identifier(exec, name))
-            : structure()->get(exec->vm(), name);
+        const String& string = name->value(exec);
+        PropertyOffset offset = string.impl()->hasHash()
+            ? structure()->get(exec->vm(), name->toIdentifier(exec))
+            : structure()->get(exec->vm(), string);
         if (offset != invalidOffset)
             return asObject(this)->locationForOffset(offset)->get();
     }
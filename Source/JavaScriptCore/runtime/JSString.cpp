@@ -226,6 +226,39 @@ void JSRopeString::outOfMemory(ExecState* exec) const
         throwOutOfMemoryError(exec);
 }
 
+// Bounds the walk down a deeply nested rope; a long chain of appends builds a
+// rope whose depth is proportional to the number of appends.
+static const unsigned maximumFiberDepthForSubstring = 32;
+
+JSString* JSRopeString::fiberForSubstring(unsigned& offset, unsigned length)
+{
+    ASSERT(offset + length <= m_length);
+
+    JSString* result = this;
+    unsigned resultOffset = offset;
+    for (unsigned depth = 0; depth < maximumFiberDepthForSubstring && result->isRope(); ++depth) {
+        JSRopeString* rope = static_cast<JSRopeString*>(result);
+        JSString* containingFiber = 0;
+        unsigned fiberOffset = resultOffset;
+        for (size_t i = 0; i < s_maxInternalRopeLength && rope->m_fibers[i]; ++i) {
+            JSString* fiber = rope->m_fibers[i].get();
+            if (fiberOffset < fiber->length()) {
+                if (fiberOffset + length <= fiber->length())
+                    containingFiber = fiber;
+                break;
+            }
+            fiberOffset -= fiber->length();
+        }
+        if (!containingFiber)
+            break;
+        result = containingFiber;
+        resultOffset = fiberOffset;
+    }
+
+    offset = resultOffset;
+    return result;
+}
+
 JSString* JSRopeString::getIndexSlowCase(ExecState* exec, unsigned i)
 {
     ASSERT(isRope());
@@ -139,6 +139,7 @@ public:
 
     const String& value(ExecState*) const;
     const String& tryGetValue() const;
+    Identifier toIdentifier(ExecState*) const;
     unsigned length() { return m_length; }
 
     JSValue toPrimitive(ExecState*, PreferredPrimitiveType) const;
@@ -317,6 +318,11 @@ public:
     }
 
     void visitFibers(SlotVisitor&);
+
+    // Finds the innermost fiber that wholly contains the range [offset, offset + length),
+    // without resolving the rope, and rebases offset onto that fiber. Returns this rope if
+    // no single fiber contains the range.
+    JS_EXPORT_PRIVATE JSString* fiberForSubstring(unsigned& offset, unsigned length);
         
     static ptrdiff_t offsetOfFibers() { return OBJECT_OFFSETOF(JSRopeString, m_fibers); }
 
@@ -386,6 +392,17 @@ inline const String& JSString::tryGetValue() const
     return m_value;
 }
 
+inline Identifier JSString::toIdentifier(ExecState* exec) const
+{
+    Identifier identifier(exec, value(exec));
+    // Hold on to the identifier's StringImpl, so that using this string as a property
+    // name again does not need another identifier table lookup. Ropes that contain this
+    // string rely on its 8-bitness, so only swap in a StringImpl with the same width.
+    if (m_value.impl() != identifier.impl() && m_value.is8Bit() == identifier.impl()->is8Bit())
+        m_value = identifier.string();
+    return identifier;
+}
+
 inline JSString* JSString::getIndex(ExecState* exec, unsigned i)
 {
     ASSERT(canGetIndex(i));
@@ -416,6 +433,12 @@ inline JSString* jsSubstring(ExecState* exec, JSString* s, unsigned offset, unsi
     VM* vm = &exec->vm();
     if (!length)
         return vm->smallStrings.emptyString();
+    if (s->isRope()) {
+        // Avoid flattening the whole rope if the substring lies within one of its fibers.
+        s = static_cast<JSRopeString*>(s)->fiberForSubstring(offset, length);
+    }
+    if (!offset && length == s->length())
+        return s;
     return jsSubstring(vm, s->value(exec), offset, length);
 }
 
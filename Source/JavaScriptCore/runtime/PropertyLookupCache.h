@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2013 Digia Plc. and/or its subsidiary(-ies)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PropertyLookupCache_h
+#define PropertyLookupCache_h
+
+#include "PropertyOffset.h"
+#include <wtf/FixedArray.h>
+#include <wtf/HashFunctions.h>
+#include <wtf/RefPtr.h>
+#include <wtf/text/StringImpl.h>
+
+namespace JSC {
+
+class Structure;
+
+// Direct-mapped cache of Structure property lookups, keyed by (Structure, uid).
+// Failed lookups are cached too, which is what makes walking the same prototype
+// chains over and over from megamorphic access sites cheap.
+//
+// Only non-dictionary structures may be cached: their property maps never change
+// in place, except through Structure::addPropertyWithoutTransition(), which
+// invalidates the affected entry. The cache is cleared on every collection, so an
+// entry can never refer to a Structure whose cell has been reused. Entries keep
+// their uid alive, for the same reason.
+class PropertyLookupCache {
+public:
+    bool get(Structure* structure, StringImpl* uid, PropertyOffset& offset)
+    {
+        Entry& entry = entryFor(structure, uid);
+        if (entry.structure != structure || entry.uid != uid)
+            return false;
+        offset = entry.offset;
+        return true;
+    }
+
+    void set(Structure* structure, StringImpl* uid, PropertyOffset offset)
+    {
+        Entry& entry = entryFor(structure, uid);
+        entry.structure = structure;
+        entry.uid = uid;
+        entry.offset = offset;
+    }
+
+    void invalidate(Structure* structure, StringImpl* uid)
+    {
+        Entry& entry = entryFor(structure, uid);
+        if (entry.structure == structure && entry.uid == uid)
+            entry = Entry();
+    }
+
+    void clear()
+    {
+        for (unsigned i = 0; i < cacheSize; ++i)
+            m_entries[i] = Entry();
+    }
+
+private:
+    static const unsigned cacheSize = 512;
+
+    struct Entry {
+        Entry()
+            : structure(0)
+            , offset(invalidOffset)
+        {
+        }
+
+        Structure* structure;
+        RefPtr<StringImpl> uid;
+        PropertyOffset offset;
+    };
+
+    Entry& entryFor(Structure* structure, StringImpl* uid)
+    {
+        unsigned hash = WTF::PtrHash<Structure*>::hash(structure) ^ uid->hash();
+        return m_entries[hash & (cacheSize - 1)];
+    }
+
+    FixedArray<Entry, cacheSize> m_entries;
+};
+
+} // namespace JSC
+
+#endif // PropertyLookupCache_h
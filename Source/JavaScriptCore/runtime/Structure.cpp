@@ -669,6 +669,8 @@ PropertyOffset Structure::addPropertyWithoutTransition(VM& vm, PropertyName prop
     
     pin();
 
+    vm.propertyLookupCache.invalidate(this, propertyName.uid());
+
     return putSpecificValue(vm, propertyName, attributes, specificValue);
 }
 
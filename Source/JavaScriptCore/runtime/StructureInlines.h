@@ -60,12 +60,23 @@ inline Structure* Structure::create(VM& vm, const Structure* structure)
 inline PropertyOffset Structure::get(VM& vm, PropertyName propertyName)
 {
     ASSERT(structure()->classInfo() == &s_info);
+    StringImpl* uid = propertyName.uid();
+    bool isCacheable = !isDictionary();
+    PropertyOffset offset;
+    if (isCacheable && vm.propertyLookupCache.get(this, uid, offset))
+        return offset;
+
     materializePropertyMapIfNecessary(vm);
-    if (!propertyTable())
-        return invalidOffset;
+    offset = invalidOffset;
+    if (propertyTable()) {
+        PropertyMapEntry* entry = propertyTable()->find(uid).first;
+        if (entry)
+            offset = entry->offset;
+    }
 
-    PropertyMapEntry* entry = propertyTable()->find(propertyName.uid()).first;
-    return entry ? entry->offset : invalidOffset;
+    if (isCacheable)
+        vm.propertyLookupCache.set(this, uid, offset);
+    return offset;
 }
 
 inline PropertyOffset Structure::get(VM& vm, const WTF::String& name)
@@ -271,6 +271,7 @@ VM::~VM()
     ASSERT(m_apiLock->currentThreadIsHoldingLock());
     m_apiLock->willDestroyVM(this);
     heap.lastChanceToFinalize();
+    propertyLookupCache.clear();
 
     delete interpreter;
 #ifndef NDEBUG
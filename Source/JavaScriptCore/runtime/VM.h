@@ -43,6 +43,7 @@
 #include "NumericStrings.h"
 #include "ProfilerDatabase.h"
 #include "PrivateName.h"
+#include "PropertyLookupCache.h"
 #include "PrototypeMap.h"
 #include "SmallStrings.h"
 #include "Strong.h"
@@ -265,6 +266,7 @@ namespace JSC {
         const MarkedArgumentBuffer* emptyList; // Lists are supposed to be allocated on the stack to have their elements properly marked, which is not the case here - but this list has nothing to mark.
         SmallStrings smallStrings;
         NumericStrings numericStrings;
+        PropertyLookupCache propertyLookupCache;
         DateInstanceCache dateInstanceCache;
         WTF::SimpleStats machineCodeBytesPerBytecodeWordForBaselineJIT;
         Vector<CodeBlock*> codeBlocksBeingCompiled;
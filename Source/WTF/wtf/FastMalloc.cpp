@@ -400,6 +400,11 @@ FastMallocStatistics fastMallocStatistics()
     return statistics;
 }
 
+size_t fastMallocSizeClassStatistics(FastMallocSizeClassStatistics*, size_t)
+{
+    return 0;
+}
+
 size_t fastMallocSize(const void* p)
 {
 #if ENABLE(WTF_MALLOC_VALIDATION)
@@ -1340,6 +1345,14 @@ class TCMalloc_Central_FreeList {
     return used_slots_ * num_objects_to_move[size_class_];
   }
 
+#ifdef WTF_CHANGES
+  // Returns the number of spans carved up into objects of this size class.
+  size_t span_count() {
+    SpinLockHolder h(&lock_);
+    return span_count_;
+  }
+#endif
+
 #ifdef WTF_CHANGES
   template <class Finder, class Reader>
   void enumerateFreeObjects(Finder& finder, const Reader& reader, TCMalloc_Central_FreeList* remoteCentralFreeList)
@@ -1430,6 +1443,7 @@ class TCMalloc_Central_FreeList {
   Span     empty_;          // Dummy header for list of empty spans
   Span     nonempty_;       // Dummy header for list of non-empty spans
   size_t   counter_;        // Number of free objects in cache entry
+  size_t   span_count_;     // Number of spans owned by this size class
 
   // Here we reserve space for TCEntry cache slots.  Since one size class can
   // end up getting all the TCEntries quota in the system we just preallocate
@@ -2912,6 +2926,7 @@ void TCMalloc_Central_FreeList::Init(size_t cl, uintptr_t entropy) {
   DLL_Init(&empty_, entropy_);
   DLL_Init(&nonempty_, entropy_);
   counter_ = 0;
+  span_count_ = 0;
 
   cache_size_ = 1;
   used_slots_ = 0;
@@ -2956,6 +2971,7 @@ ALWAYS_INLINE void TCMalloc_Central_FreeList::ReleaseToSpans(HardenedSLL object)
   if (span->refcount == 0) {
     Event(span, '#', 0);
     counter_ -= (span->length<<kPageShift) / ByteSizeForClass(span->sizeclass);
+    span_count_--;
     DLL_Remove(span, entropy_);
 
     // Release central list lock while operating on pageheap
@@ -3193,6 +3209,7 @@ ALWAYS_INLINE void TCMalloc_Central_FreeList::Populate() {
   lock_.Lock();
   DLL_Prepend(&nonempty_, span, entropy_);
   counter_ += num;
+  span_count_++;
 }
 
 //-------------------------------------------------------------------
@@ -4662,6 +4679,34 @@ FastMallocStatistics fastMallocStatistics()
     return statistics;
 }
 
+size_t fastMallocSizeClassStatistics(FastMallocSizeClassStatistics* statistics, size_t capacity)
+{
+    // Size class 0 is unused.
+    const size_t sizeClassCount = kNumClasses - 1;
+    size_t count = std::min(capacity, sizeClassCount);
+
+    for (size_t i = 0; i < count; ++i) {
+        size_t cl = i + 1;
+        const size_t objectSize = ByteSizeForClass(cl);
+        TCMalloc_Central_FreeList& centralFreeList = central_cache[cl];
+
+        statistics[i].objectSize = objectSize;
+        statistics[i].spanBytes = centralFreeList.span_count() * (class_to_pages[cl] << kPageShift);
+        statistics[i].centralCacheBytes = objectSize * (centralFreeList.length() + centralFreeList.tc_length());
+        statistics[i].threadCacheBytes = 0;
+    }
+
+    // The page heap lock keeps the list of thread caches stable, but each cache's free lists
+    // keep changing under their owning thread, so these lengths are a racy snapshot.
+    SpinLockHolder lockHolder(&pageheap_lock);
+    for (TCMalloc_ThreadCache* threadCache = thread_heaps; threadCache; threadCache = threadCache->next_) {
+        for (size_t i = 0; i < count; ++i)
+            statistics[i].threadCacheBytes += statistics[i].objectSize * threadCache->freelist_length(i + 1);
+    }
+
+    return sizeClassCount;
+}
+
 size_t fastMallocSize(const void* ptr)
 {
 #if ENABLE(WTF_MALLOC_VALIDATION)
@@ -90,6 +90,17 @@ namespace WTF {
     };
     WTF_EXPORT_PRIVATE FastMallocStatistics fastMallocStatistics();
 
+    struct FastMallocSizeClassStatistics {
+        size_t objectSize;
+        size_t spanBytes; // Bytes in spans carved into objects of this size, in use or free.
+        size_t centralCacheBytes; // Free bytes in the central and transfer caches.
+        size_t threadCacheBytes; // Free bytes in all thread caches.
+    };
+    // Fills in at most capacity entries, one per size class, and returns the number of
+    // size classes. Returns 0 when the system malloc is in use. The thread cache figures
+    // are read without stopping their threads, so the numbers are only approximate.
+    WTF_EXPORT_PRIVATE size_t fastMallocSizeClassStatistics(FastMallocSizeClassStatistics*, size_t capacity);
+
     // This defines a type which holds an unsigned integer and is the same
     // size as the minimally aligned memory allocation.
     typedef unsigned long long AllocAlignmentInteger;
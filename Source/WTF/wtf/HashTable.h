@@ -455,6 +455,10 @@ namespace WTF {
         bool shouldExpand() const { return (m_keyCount + m_deletedCount) * m_maxLoad >= m_tableSize; }
         bool mustRehashInPlace() const { return m_keyCount * m_minLoad < m_tableSize * 2; }
         bool shouldShrink() const { return m_keyCount * m_minLoad < m_tableSize && m_tableSize > KeyTraits::minimumTableSize; }
+        // Deleted buckets lengthen every unsuccessful probe sequence, and are otherwise only cleaned
+        // out by shouldExpand() on insertion. Tables that churn through removals rehash in place
+        // once deleted buckets outnumber the keys and fill a quarter of the table.
+        bool shouldRemoveDeletedBuckets() const { return m_deletedCount >= m_keyCount && m_deletedCount * m_maxDeletedLoad >= m_tableSize && m_tableSize > KeyTraits::minimumTableSize; }
         void expand();
         void shrink() { rehash(m_tableSize / 2); }
 
@@ -486,6 +490,7 @@ namespace WTF {
 
         static const int m_maxLoad = 2;
         static const int m_minLoad = 6;
+        static const int m_maxDeletedLoad = 4;
 
         ValueType* m_table;
         int m_tableSize;
@@ -1033,6 +1038,8 @@ namespace WTF {
 
         if (shouldShrink())
             shrink();
+        else if (shouldRemoveDeletedBuckets())
+            rehash(m_tableSize);
 
         internalCheckTableConsistency();
     }
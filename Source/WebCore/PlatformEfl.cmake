@@ -139,6 +139,7 @@ list(APPEND WebCore_SOURCES
     platform/image-decoders/cairo/ImageDecoderCairo.cpp
 
     platform/linux/GamepadDeviceLinux.cpp
+    platform/linux/MemoryPressureHandlerLinux.cpp
 
     platform/mediastream/gstreamer/MediaStreamCenterGStreamer.cpp
 
@@ -1062,6 +1062,7 @@ SOURCES += \
     platform/LinkHash.cpp \
     platform/Logging.cpp \
     platform/MemoryPressureHandler.cpp \
+    platform/linux/MemoryPressureHandlerLinux.cpp \
     platform/MIMETypeRegistry.cpp \
     platform/mock/DeviceMotionClientMock.cpp \
     platform/mock/DeviceOrientationClientMock.cpp \
@@ -2147,6 +2148,7 @@ HEADERS += \
     platform/graphics/cpu/arm/filters/FECompositeArithmeticNEON.h \
     platform/graphics/cpu/arm/filters/FEGaussianBlurNEON.h \
     platform/graphics/cpu/arm/filters/FELightingNEON.h \
+    platform/graphics/cpu/x86/filters/FEGaussianBlurSSE2.h \
     platform/graphics/CrossfadeGeneratedImage.h \
     platform/graphics/filters/texmap/TextureMapperPlatformCompiledProgram.h \
     platform/graphics/filters/CustomFilterArrayParameter.h \
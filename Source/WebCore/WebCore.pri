@@ -59,6 +59,7 @@ INCLUDEPATH += \
     $$SOURCE_DIR/platform/graphics \
     $$SOURCE_DIR/platform/graphics/cpu/arm \
     $$SOURCE_DIR/platform/graphics/cpu/arm/filters \
+    $$SOURCE_DIR/platform/graphics/cpu/x86/filters \
     $$SOURCE_DIR/platform/graphics/filters \
     $$SOURCE_DIR/platform/graphics/filters/texmap \
     $$SOURCE_DIR/platform/graphics/opengl \
@@ -71,6 +71,7 @@
 #include <wtf/HashTraits.h>
 #include <wtf/Uint8ClampedArray.h>
 #include <wtf/Vector.h>
+#include <wtf/text/StringHash.h>
 
 using namespace JSC;
 using namespace std;
@@ -322,6 +323,28 @@ template <typename T> static bool writeLittleEndian(Vector<uint8_t>& buffer, con
     return true;
 }
 
+static bool writeStringCharacters(Vector<uint8_t>& buffer, const StringImpl* string)
+{
+    uint32_t length = string->length();
+    if (!string->is8Bit())
+        return writeLittleEndian(buffer, reinterpret_cast<const uint16_t*>(string->characters16()), length);
+
+    if (length > numeric_limits<uint32_t>::max() / sizeof(UChar))
+        return false;
+
+    // Widen Latin-1 characters straight into the buffer instead of upconverting the string,
+    // which would leave a 16-bit copy of every serialized string hanging off its StringImpl.
+    const LChar* characters = string->characters8();
+    size_t start = buffer.size();
+    buffer.grow(start + length * sizeof(UChar));
+    uint8_t* out = buffer.data() + start;
+    for (uint32_t i = 0; i < length; ++i) {
+        *out++ = characters[i];
+        *out++ = 0;
+    }
+    return true;
+}
+
 class CloneSerializer : CloneBase {
 public:
     static SerializationReturnCode serialize(ExecState* exec, JSValue value,
@@ -341,7 +364,7 @@ public:
         }
         writeLittleEndian<uint8_t>(out, StringTag);
         writeLittleEndian(out, s.length());
-        return writeLittleEndian(out, s.impl()->characters(), s.length());
+        return writeStringCharacters(out, s.impl());
     }
 
     static void serializeUndefined(Vector<uint8_t>& out)
@@ -375,7 +398,6 @@ private:
         : CloneBase(exec)
         , m_buffer(out)
         , m_blobURLs(blobURLs)
-        , m_emptyIdentifier(exec, emptyString())
     {
         write(CurrentVersion);
         fillTransferMap(messagePorts, m_transferredMessagePorts);
@@ -765,7 +787,14 @@ private:
 
     void write(const Identifier& ident)
     {
-        const String& str = ident.string();
+        write(ident.string());
+    }
+
+    void write(const String& string)
+    {
+        // Strings are pooled by content rather than atomized, so large string payloads
+        // never touch the identifier table.
+        const String& str = string.isNull() ? emptyString() : string;
         StringConstantPool::AddResult addResult = m_constantPool.add(str.impl(), m_constantPool.size());
         if (!addResult.isNewEntry) {
             write(StringPoolTag);
@@ -787,18 +816,10 @@ private:
         }
 
         writeLittleEndian<uint32_t>(m_buffer, str.length());
-        if (!writeLittleEndian<uint16_t>(m_buffer, reinterpret_cast<const uint16_t*>(str.characters()), str.length()))
+        if (!writeStringCharacters(m_buffer, str.impl()))
             fail();
     }
 
-    void write(const String& str)
-    {
-        if (str.isNull())
-            write(m_emptyIdentifier);
-        else
-            write(Identifier(m_exec, str));
-    }
-
     void write(const File* file)
     {
         m_blobURLs.append(file->url());
@@ -817,9 +838,8 @@ private:
     ObjectPool m_objectPool;
     ObjectPool m_transferredMessagePorts;
     ObjectPool m_transferredArrayBuffers;
-    typedef HashMap<RefPtr<StringImpl>, uint32_t, IdentifierRepHash> StringConstantPool;
+    typedef HashMap<RefPtr<StringImpl>, uint32_t, StringHash> StringConstantPool;
     StringConstantPool m_constantPool;
-    Identifier m_emptyIdentifier;
 };
 
 SerializationReturnCode CloneSerializer::serialize(JSValue in)
@@ -1188,7 +1208,16 @@ private:
             return false;
 
 #if ASSUME_LITTLE_ENDIAN
-        str = String(reinterpret_cast<const UChar*>(ptr), length);
+        // Most serialized strings started out as Latin-1; hand them back as 8-bit strings
+        // so the receiving side does not pay for twice the memory.
+        const UChar* characters = reinterpret_cast<const UChar*>(ptr);
+        UChar ored = 0;
+        for (unsigned i = 0; i < length; ++i)
+            ored |= characters[i];
+        if (!(ored & ~0xFF))
+            str = String::make8BitFrom16BitSource(characters, length);
+        else
+            str = String(characters, length);
         ptr += length * sizeof(UChar);
 #else
         Vector<UChar> buffer;
@@ -959,48 +959,38 @@ static int indexOfMetaEnum(const QMetaObject *meta, const QByteArray &str)
     return -1;
 }
 
-// Helper function for resolving methods
-// Largely based on code in QtScript for compatibility reasons
-static int findMethodIndex(JSContextRef context,
-                           const QMetaObject* meta,
-                           const QByteArray& signature,
-                           int argumentCount,
-                           const JSValueRef arguments[],
-                           bool allowPrivate,
-                           QVarLengthArray<QVariant, 10> &vars,
-                           void** vvars,
-                           JSValueRef* exception)
-{
-    QList<int> matchingIndices;
+// The overloads a method name can resolve to, and their return and parameter types,
+// only depend on the QMetaObject, so QtRuntimeMethod computes them once and reuses them
+// for every call.
+struct QtMethodCandidate {
+    int index;
+    QVector<QtMethodMatchType> types;
+    bool unresolvedTypes;
+};
+
+struct QtMethodCandidates {
+    const QMetaObject* metaObject;
+    QVector<QtMethodCandidate> candidates;
+};
 
+static void resolveMethodCandidates(const QMetaObject* meta,
+                                    const QByteArray& signature,
+                                    bool allowPrivate,
+                                    QVector<QtMethodCandidate>& candidates)
+{
     bool overloads = !signature.contains('(');
 
     int count = meta->methodCount();
-    for (int i = count - 1; i >= 0; --i) {
-        const QMetaMethod m = meta->method(i);
+    for (int index = count - 1; index >= 0; --index) {
+        const QMetaMethod method = meta->method(index);
 
         // Don't choose private methods
-        if (m.access() == QMetaMethod::Private && !allowPrivate)
+        if (method.access() == QMetaMethod::Private && !allowPrivate)
             continue;
 
         // try and find all matching named methods
-        if (!overloads && m.methodSignature() == signature)
-            matchingIndices.append(i);
-        else if (overloads && m.name() == signature)
-            matchingIndices.append(i);
-    }
-
-    int chosenIndex = -1;
-    QVector<QtMethodMatchType> chosenTypes;
-
-    QVarLengthArray<QVariant, 10> args;
-    QVector<QtMethodMatchData> candidates;
-    QVector<QtMethodMatchData> unresolved;
-    QVector<int> tooFewArgs;
-    QVector<int> conversionFailed;
-
-    foreach(int index, matchingIndices) {
-        QMetaMethod method = meta->method(index);
+        if (overloads ? method.name() != signature : method.methodSignature() != signature)
+            continue;
 
         QVector<QtMethodMatchType> types;
         bool unresolvedTypes = false;
@@ -1048,6 +1038,44 @@ static int findMethodIndex(JSContextRef context,
             }
         }
 
+        QtMethodCandidate candidate;
+        candidate.index = index;
+        candidate.types = types;
+        candidate.unresolvedTypes = unresolvedTypes;
+        candidates.append(candidate);
+    }
+}
+
+// Helper function for resolving methods
+// Largely based on code in QtScript for compatibility reasons
+static int findMethodIndex(JSContextRef context,
+                           const QMetaObject* meta,
+                           const QByteArray& signature,
+                           const QVector<QtMethodCandidate>& matchingCandidates,
+                           int argumentCount,
+                           const JSValueRef arguments[],
+                           QVarLengthArray<QVariant, 10> &vars,
+                           void** vvars,
+                           JSValueRef* exception)
+{
+    bool overloads = !signature.contains('(');
+
+    int chosenIndex = -1;
+    QVector<QtMethodMatchType> chosenTypes;
+
+    QVarLengthArray<QVariant, 10> args;
+    QVector<QtMethodMatchData> candidates;
+    QVector<QtMethodMatchData> unresolved;
+    QVector<int> tooFewArgs;
+    QVector<int> conversionFailed;
+
+    foreach (const QtMethodCandidate& candidate, matchingCandidates) {
+        int index = candidate.index;
+        QMetaMethod method = meta->method(index);
+
+        const QVector<QtMethodMatchType>& types = candidate.types;
+        bool unresolvedTypes = candidate.unresolvedTypes;
+
         // If the native method requires more arguments than what was passed from JavaScript
         if (argumentCount + 1 < static_cast<unsigned>(types.count())) {
             qMatchDebug() << "Match:too few args for" << method.methodSignature();
@@ -1253,8 +1281,16 @@ JSValueRef QtRuntimeMethod::call(JSContextRef context, JSObjectRef function, JSO
     void* qargs[11];
     const QMetaObject* metaObject = obj->metaObject();
 
-    int methodIndex = findMethodIndex(context, metaObject, d->m_identifier,  argumentCount, arguments,
-                                      (d->m_flags & AllowPrivate), vargs, (void **)qargs, exception);
+    if (!d->m_candidates || d->m_candidates->metaObject != metaObject) {
+        if (!d->m_candidates)
+            d->m_candidates = adoptPtr(new QtMethodCandidates);
+        d->m_candidates->metaObject = metaObject;
+        d->m_candidates->candidates.clear();
+        resolveMethodCandidates(metaObject, d->m_identifier, (d->m_flags & AllowPrivate), d->m_candidates->candidates);
+    }
+
+    int methodIndex = findMethodIndex(context, metaObject, d->m_identifier, d->m_candidates->candidates, argumentCount, arguments,
+                                      vargs, (void **)qargs, exception);
 
     if (QMetaObject::metacall(obj, QMetaObject::InvokeMetaMethod, methodIndex, qargs) >= 0)
         return JSValueMakeUndefined(context);
@@ -27,6 +27,7 @@
 #include "WeakInlines.h"
 #include "qt_instance.h"
 #include "runtime_method.h"
+#include <wtf/OwnPtr.h>
 
 #include <QPointer>
 
@@ -77,6 +78,8 @@ private:
     QPointer<QObject> m_childObject;
 };
 
+struct QtMethodCandidates;
+
 class QtRuntimeMethod {
 public:
     enum MethodFlags {
@@ -105,6 +108,7 @@ private:
     int m_flags;
     Weak<JSObject> m_jsObject;
     QtInstance* m_instance;
+    OwnPtr<QtMethodCandidates> m_candidates;
 };
 
 // A QtConnectionObject represents a connection created inside JS. It will connect its own execute() slot
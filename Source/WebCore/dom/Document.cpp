@@ -410,6 +410,7 @@ Document::Document(Frame* frame, const KURL& url, unsigned documentClasses)
     , m_compatibilityModeLocked(false)
     , m_textColor(Color::black)
     , m_domTreeVersion(++s_globalTreeVersion)
+    , m_hasSelectorQueryCachedResults(false)
     , m_listenerTypes(0)
     , m_mutationObserverTypes(0)
     , m_styleSheetCollection(DocumentStyleSheetCollection::create(this))
@@ -632,6 +633,7 @@ void Document::dispose()
     m_activeElement = 0;
     m_titleElement = 0;
     m_documentElement = 0;
+    clearSelectorQueryCachedResults();
     m_contextFeatures = ContextFeatures::defaultSwitch();
     m_userActionElements.documentDidRemoveLastRef();
 #if ENABLE(FULLSCREEN_API)
@@ -703,6 +705,13 @@ SelectorQueryCache* Document::selectorQueryCache()
     return m_selectorQueryCache.get();
 }
 
+void Document::clearSelectorQueryCachedResults()
+{
+    m_hasSelectorQueryCachedResults = false;
+    if (m_selectorQueryCache)
+        m_selectorQueryCache->clearCachedResults();
+}
+
 MediaQueryMatcher* Document::mediaQueryMatcher()
 {
     if (!m_mediaQueryMatcher)
@@ -3663,6 +3672,8 @@ void Document::addMutationEventListenerTypeIfEnabled(ListenerType listenerType)
 
 void Document::addListenerTypeIfNeeded(const AtomicString& eventType)
 {
+    m_eventListenerTypes.add(eventType);
+
     if (eventType == eventNames().DOMSubtreeModifiedEvent)
         addMutationEventListenerTypeIfEnabled(DOMSUBTREEMODIFIED_LISTENER);
     else if (eventType == eventNames().DOMNodeInsertedEvent)
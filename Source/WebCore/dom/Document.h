@@ -54,6 +54,7 @@
 #include <wtf/PassOwnPtr.h>
 #include <wtf/PassRefPtr.h>
 #include <wtf/WeakPtr.h>
+#include <wtf/text/AtomicStringHash.h>
 
 namespace WebCore {
 
@@ -251,6 +252,9 @@ public:
     void invalidateAccessKeyMap();
 
     SelectorQueryCache* selectorQueryCache();
+    // Cached querySelectorAll() results hold on to the matched nodes, so they are dropped as
+    // soon as the tree version changes instead of waiting for the next identical query.
+    void didCacheSelectorQueryResult() { m_hasSelectorQueryCachedResults = true; }
 
     // DOM methods & attributes for Document
 
@@ -759,6 +763,10 @@ public:
     bool hasListenerType(ListenerType listenerType) const { return (m_listenerTypes & listenerType); }
     void addListenerTypeIfNeeded(const AtomicString& eventType);
 
+    // False only if no node in this document ever had a listener for eventType. Like the
+    // ListenerType bits, this is never reset when listeners are removed.
+    bool mayHaveEventListenersOfType(const AtomicString& eventType) const { return m_eventListenerTypes.contains(eventType); }
+
     bool hasMutationObserversOfType(MutationObserver::MutationType type) const
     {
         return m_mutationObserverTypes & type;
@@ -891,7 +899,12 @@ public:
     TransformSource* transformSource() const { return m_transformSource.get(); }
 #endif
 
-    void incDOMTreeVersion() { m_domTreeVersion = ++s_globalTreeVersion; }
+    void incDOMTreeVersion()
+    {
+        m_domTreeVersion = ++s_globalTreeVersion;
+        if (m_hasSelectorQueryCachedResults)
+            clearSelectorQueryCachedResults();
+    }
     uint64_t domTreeVersion() const { return m_domTreeVersion; }
 
     void setDocType(PassRefPtr<DocumentType>);
@@ -1212,6 +1225,8 @@ private:
 
     void detachParser();
 
+    void clearSelectorQueryCachedResults();
+
     typedef void (*ArgumentsCallback)(const String& keyString, const String& valueString, Document*, void* data);
     void processArguments(const String& features, void* data, ArgumentsCallback);
 
@@ -1345,11 +1360,13 @@ private:
 
     uint64_t m_domTreeVersion;
     static uint64_t s_globalTreeVersion;
+    bool m_hasSelectorQueryCachedResults;
     
     HashSet<NodeIterator*> m_nodeIterators;
     HashSet<Range*> m_ranges;
 
     unsigned short m_listenerTypes;
+    HashSet<AtomicString> m_eventListenerTypes;
 
     MutationObserverOptions m_mutationObserverTypes;
 
@@ -3149,6 +3149,24 @@ PassRefPtr<RenderStyle> Element::customStyleForRenderer()
     return 0;
 }
 
+// While the document's shared object pool is alive, elements with identical attributes (typically the
+// clones made by template-style cloneNode() loops) end up pointing at a single ShareableElementData.
+// Inline style is per element, so data that has one is never interned. The interned data is built from
+// the attributes alone and does not carry over the name attribute flag, the dirty style bits, the class
+// names or idForStyleResolution. This is only correct because cloneAttributesFromElement() then runs
+// attributeChangedFromParserOrByCloning() for every attribute, which recomputes that state on the shared
+// data for both elements.
+static PassRefPtr<ShareableElementData> makeShareableElementData(const UniqueElementData& elementData, Document* document)
+{
+    DocumentSharedObjectPool* pool = document ? document->sharedObjectPool() : 0;
+    if (!pool || elementData.inlineStyle() || !elementData.length())
+        return elementData.makeShareableCopy();
+
+    Vector<Attribute> attributes;
+    attributes.append(elementData.m_attributeVector.data(), elementData.m_attributeVector.size());
+    return pool->cachedShareableElementDataWithAttributes(attributes);
+}
+
 void Element::cloneAttributesFromElement(const Element& other)
 {
     if (hasSyntheticAttrChildNodes())
@@ -3178,10 +3196,11 @@ void Element::cloneAttributesFromElement(const Element& other)
 
     // If 'other' has a mutable ElementData, convert it to an immutable one so we can share it between both elements.
     // We can only do this if there is no CSSOM wrapper for other's inline style, and there are no presentation attributes.
+    // The new data replaces other's own, so it is interned in other's document even when cloning across documents.
     if (other.m_elementData->isUnique()
         && !other.m_elementData->presentationAttributeStyle()
         && (!other.m_elementData->inlineStyle() || !other.m_elementData->inlineStyle()->hasCSSOMWrapper()))
-        const_cast<Element&>(other).m_elementData = static_cast<const UniqueElementData*>(other.m_elementData.get())->makeShareableCopy();
+        const_cast<Element&>(other).m_elementData = makeShareableElementData(static_cast<const UniqueElementData&>(*other.m_elementData), other.document());
 
     if (!other.m_elementData->isUnique())
         m_elementData = other.m_elementData;
@@ -27,6 +27,7 @@
 #include "EventDispatcher.h"
 
 #include "ContainerNode.h"
+#include "DOMWindow.h"
 #include "ElementShadow.h"
 #include "EventContext.h"
 #include "EventDispatchMediator.h"
@@ -53,6 +54,24 @@ bool EventDispatcher::dispatchEvent(Node* node, PassRefPtr<EventDispatchMediator
     return mediator->dispatchEvent(&dispatcher);
 }
 
+static bool mayHaveEventListeners(Document* document, const AtomicString& eventType)
+{
+    if (document->mayHaveEventListenersOfType(eventType))
+        return true;
+    DOMWindow* window = document->domWindow();
+    return window && window->hasEventListeners(eventType);
+}
+
+bool EventDispatcher::hasEventListeners() const
+{
+    Document* document = m_node->document();
+    const AtomicString& eventType = m_event->type();
+    if (mayHaveEventListeners(document, eventType))
+        return true;
+    // EventTarget::fireEventListeners() also delivers transitionend to legacy webkitTransitionEnd listeners.
+    return eventType == eventNames().transitionendEvent && mayHaveEventListeners(document, eventNames().webkitTransitionEndEvent);
+}
+
 EventDispatcher::EventDispatcher(Node* node, PassRefPtr<Event> event)
     : m_node(node)
     , m_event(event)
@@ -114,7 +133,9 @@ bool EventDispatcher::dispatch()
     InspectorInstrumentationCookie cookie = InspectorInstrumentation::willDispatchEvent(m_node->document(), *m_event, windowEventContext.window(), m_node.get(), m_eventPath);
 
     void* preDispatchEventHandlerResult;
-    if (dispatchEventPreProcess(preDispatchEventHandlerResult) == ContinueDispatching)
+    // Checked after the pre-dispatch handler, which is the last chance for anything to add
+    // listeners before the capture phase; once a listener runs, all phases are dispatched.
+    if (dispatchEventPreProcess(preDispatchEventHandlerResult) == ContinueDispatching && hasEventListeners())
         if (dispatchEventAtCapturing(windowEventContext) == ContinueDispatching)
             if (dispatchEventAtTarget() == ContinueDispatching)
                 dispatchEventAtBubbling(windowEventContext);
@@ -63,6 +63,11 @@ public:
     Event* event() const { return m_event.get(); }
     EventPath& eventPath() { return m_eventPath; }
 
+    // False when no node on the path or the window can have a listener for the event, in which
+    // case only the pre- and post-dispatch and default event handlers run. This is not cached,
+    // since script running during dispatch can add listeners.
+    bool hasEventListeners() const;
+
 private:
     EventDispatcher(Node*, PassRefPtr<Event>);
     const EventContext* topEventContext();
@@ -45,24 +45,35 @@ namespace {
 
 class ChildListRecord : public MutationRecord {
 public:
-    ChildListRecord(PassRefPtr<Node> target, PassRefPtr<NodeList> added, PassRefPtr<NodeList> removed, PassRefPtr<Node> previousSibling, PassRefPtr<Node> nextSibling)
+    ChildListRecord(PassRefPtr<Node> target, Vector<RefPtr<Node> >& added, Vector<RefPtr<Node> >& removed, PassRefPtr<Node> previousSibling, PassRefPtr<Node> nextSibling)
         : m_target(target)
-        , m_addedNodes(added)
-        , m_removedNodes(removed)
         , m_previousSibling(previousSibling)
         , m_nextSibling(nextSibling)
     {
+        m_addedNodeVector.swap(added);
+        m_removedNodeVector.swap(removed);
     }
 
 private:
     virtual const AtomicString& type() OVERRIDE;
     virtual Node* target() OVERRIDE { return m_target.get(); }
-    virtual NodeList* addedNodes() OVERRIDE { return m_addedNodes.get(); }
-    virtual NodeList* removedNodes() OVERRIDE { return m_removedNodes.get(); }
+    virtual NodeList* addedNodes() OVERRIDE { return lazilyInitializeNodeList(m_addedNodes, m_addedNodeVector); }
+    virtual NodeList* removedNodes() OVERRIDE { return lazilyInitializeNodeList(m_removedNodes, m_removedNodeVector); }
     virtual Node* previousSibling() OVERRIDE { return m_previousSibling.get(); }
     virtual Node* nextSibling() OVERRIDE { return m_nextSibling.get(); }
 
+    // Most records are never read by script, so keep the nodes in a plain vector and only
+    // wrap them in a NodeList on first access.
+    static NodeList* lazilyInitializeNodeList(RefPtr<NodeList>& nodeList, Vector<RefPtr<Node> >& nodes)
+    {
+        if (!nodeList)
+            nodeList = StaticNodeList::adopt(nodes);
+        return nodeList.get();
+    }
+
     RefPtr<Node> m_target;
+    Vector<RefPtr<Node> > m_addedNodeVector;
+    Vector<RefPtr<Node> > m_removedNodeVector;
     RefPtr<NodeList> m_addedNodes;
     RefPtr<NodeList> m_removedNodes;
     RefPtr<Node> m_previousSibling;
@@ -167,7 +178,7 @@ const AtomicString& CharacterDataRecord::type()
 
 } // namespace
 
-PassRefPtr<MutationRecord> MutationRecord::createChildList(PassRefPtr<Node> target, PassRefPtr<NodeList> added, PassRefPtr<NodeList> removed, PassRefPtr<Node> previousSibling, PassRefPtr<Node> nextSibling)
+PassRefPtr<MutationRecord> MutationRecord::createChildList(PassRefPtr<Node> target, Vector<RefPtr<Node> >& added, Vector<RefPtr<Node> >& removed, PassRefPtr<Node> previousSibling, PassRefPtr<Node> nextSibling)
 {
     return adoptRef(static_cast<MutationRecord*>(new ChildListRecord(target, added, removed, previousSibling, nextSibling)));
 }
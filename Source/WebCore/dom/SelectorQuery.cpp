@@ -87,6 +87,11 @@ PassRefPtr<NodeList> SelectorDataList::queryAll(Node* rootNode) const
     return StaticNodeList::adopt(result);
 }
 
+void SelectorDataList::queryAll(Node* rootNode, Vector<RefPtr<Node> >& result) const
+{
+    execute<false>(rootNode, result);
+}
+
 PassRefPtr<Element> SelectorDataList::queryFirst(Node* rootNode) const
 {
     Vector<RefPtr<Node> > result;
@@ -283,12 +288,84 @@ ALWAYS_INLINE void SelectorDataList::execute(Node* rootNode, Vector<RefPtr<Node>
     executeSingleMultiSelectorData<firstMatchOnly>(rootNode, matchedElements);
 }
 
+// Attribute selectors are left out on purpose: the style attribute and animated SVG
+// attributes are synchronized lazily, without bumping the DOM tree version.
+static bool selectorMatchDependsOnlyOnTree(const CSSSelector* selector)
+{
+    for (; selector; selector = selector->tagHistory()) {
+        switch (selector->m_match) {
+        case CSSSelector::Tag:
+        case CSSSelector::Id:
+        case CSSSelector::Class:
+            break;
+        default:
+            return false;
+        }
+        if (selector->relation() == CSSSelector::ShadowDescendant)
+            return false;
+    }
+    return true;
+}
+
+static bool selectorListMatchDependsOnlyOnTree(const CSSSelectorList& selectorList)
+{
+    for (const CSSSelector* selector = selectorList.first(); selector; selector = CSSSelectorList::next(selector)) {
+        if (!selectorMatchDependsOnlyOnTree(selector))
+            return false;
+    }
+    return true;
+}
+
 SelectorQuery::SelectorQuery(const CSSSelectorList& selectorList)
     : m_selectorList(selectorList)
+    , m_resultIsCacheable(selectorListMatchDependsOnlyOnTree(m_selectorList))
+    , m_cachedRootNode(0)
+    , m_cachedDOMTreeVersion(0)
 {
     m_selectors.initialize(m_selectorList);
 }
 
+bool SelectorQuery::hasCachedResultFor(Node* rootNode) const
+{
+    return m_cachedRootNode == rootNode && m_cachedDOMTreeVersion == rootNode->document()->domTreeVersion();
+}
+
+PassRefPtr<NodeList> SelectorQuery::queryAll(Node* rootNode) const
+{
+    if (!m_resultIsCacheable)
+        return m_selectors.queryAll(rootNode);
+
+    if (!hasCachedResultFor(rootNode)) {
+        clearCachedResult();
+        m_selectors.queryAll(rootNode, m_cachedResult);
+        m_cachedRootNode = rootNode;
+        // The document owns this cache, so only hold a reference to other roots. This
+        // keeps a detached root alive so its address can't be reused by another node.
+        if (!rootNode->isDocumentNode())
+            m_cachedRootNodeProtector = rootNode;
+        m_cachedDOMTreeVersion = rootNode->document()->domTreeVersion();
+        rootNode->document()->didCacheSelectorQueryResult();
+    }
+
+    Vector<RefPtr<Node> > result(m_cachedResult);
+    return StaticNodeList::adopt(result);
+}
+
+PassRefPtr<Element> SelectorQuery::queryFirst(Node* rootNode) const
+{
+    if (m_resultIsCacheable && hasCachedResultFor(rootNode))
+        return m_cachedResult.isEmpty() ? 0 : toElement(m_cachedResult.first().get());
+    return m_selectors.queryFirst(rootNode);
+}
+
+void SelectorQuery::clearCachedResult() const
+{
+    m_cachedRootNode = 0;
+    m_cachedRootNodeProtector.clear();
+    m_cachedDOMTreeVersion = 0;
+    m_cachedResult.clear();
+}
+
 SelectorQuery* SelectorQueryCache::add(const AtomicString& selectors, Document* document, ExceptionCode& ec)
 {
     HashMap<AtomicString, OwnPtr<SelectorQuery> >::iterator it = m_entries.find(selectors);
@@ -325,4 +402,11 @@ void SelectorQueryCache::invalidate()
     m_entries.clear();
 }
 
+void SelectorQueryCache::clearCachedResults()
+{
+    HashMap<AtomicString, OwnPtr<SelectorQuery> >::iterator end = m_entries.end();
+    for (HashMap<AtomicString, OwnPtr<SelectorQuery> >::iterator it = m_entries.begin(); it != end; ++it)
+        it->value->clearCachedResult();
+}
+
 }
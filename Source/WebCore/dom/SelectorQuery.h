@@ -30,6 +30,7 @@
 #include "NodeList.h"
 #include <wtf/HashMap.h>
 #include <wtf/PassRefPtr.h>
+#include <wtf/RefPtr.h>
 #include <wtf/Vector.h>
 #include <wtf/text/AtomicStringHash.h>
 
@@ -48,6 +49,7 @@ public:
     void initialize(const CSSSelectorList&);
     bool matches(Element*) const;
     PassRefPtr<NodeList> queryAll(Node* rootNode) const;
+    void queryAll(Node* rootNode, Vector<RefPtr<Node> >&) const;
     PassRefPtr<Element> queryFirst(Node* rootNode) const;
 
 private:
@@ -78,9 +80,23 @@ public:
     bool matches(Element*) const;
     PassRefPtr<NodeList> queryAll(Node* rootNode) const;
     PassRefPtr<Element> queryFirst(Node* rootNode) const;
+
+    void clearCachedResult() const;
+
 private:
+    bool hasCachedResultFor(Node* rootNode) const;
+
     SelectorDataList m_selectors;
     CSSSelectorList m_selectorList;
+
+    // The result of the last queryAll(), reused until the DOM tree version of the
+    // root's document changes. Only kept for selectors whose match depends on nothing
+    // but the tree structure, tag names, ids and classes.
+    bool m_resultIsCacheable;
+    mutable Node* m_cachedRootNode;
+    mutable RefPtr<Node> m_cachedRootNodeProtector;
+    mutable uint64_t m_cachedDOMTreeVersion;
+    mutable Vector<RefPtr<Node> > m_cachedResult;
 };
 
 class SelectorQueryCache {
@@ -88,6 +104,7 @@ class SelectorQueryCache {
 public:
     SelectorQuery* add(const AtomicString&, Document*, ExceptionCode&);
     void invalidate();
+    void clearCachedResults();
 
 private:
     HashMap<AtomicString, OwnPtr<SelectorQuery> > m_entries;
@@ -98,16 +115,6 @@ inline bool SelectorQuery::matches(Element* element) const
     return m_selectors.matches(element);
 }
 
-inline PassRefPtr<NodeList> SelectorQuery::queryAll(Node* rootNode) const
-{
-    return m_selectors.queryAll(rootNode);
-}
-
-inline PassRefPtr<Element> SelectorQuery::queryFirst(Node* rootNode) const
-{
-    return m_selectors.queryFirst(rootNode);
-}
-
 }
 
 #endif
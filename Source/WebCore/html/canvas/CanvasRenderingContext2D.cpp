@@ -930,8 +930,11 @@ void CanvasRenderingContext2D::fill(const String& windingRuleString)
             c->fillPath(m_path);
             didDrawEntireCanvas();
         } else {
-            c->fillPath(m_path);
-            didDraw(m_path.fastBoundingRect());
+            FloatRect boundingRect = m_path.fastBoundingRect();
+            if (!rectIsOutsideCanvas(boundingRect, state().m_globalComposite)) {
+                c->fillPath(m_path);
+                didDraw(boundingRect);
+            }
         }
         
         c->setFillRule(windRule);
@@ -959,8 +962,10 @@ void CanvasRenderingContext2D::stroke()
         FloatRect dirtyRect = m_path.fastBoundingRect();
         inflateStrokeRect(dirtyRect);
 
-        c->strokePath(m_path);
-        didDraw(dirtyRect);
+        if (!rectIsOutsideCanvas(dirtyRect, state().m_globalComposite)) {
+            c->strokePath(m_path);
+            didDraw(dirtyRect);
+        }
     }
 
 #if ENABLE(DASHBOARD_SUPPORT)
@@ -1095,7 +1100,7 @@ void CanvasRenderingContext2D::fillRect(float x, float y, float width, float hei
         clearCanvas();
         c->fillRect(rect);
         didDrawEntireCanvas();
-    } else {
+    } else if (!rectIsOutsideCanvas(rect, state().m_globalComposite)) {
         c->fillRect(rect);
         didDraw(rect);
     }
@@ -1124,6 +1129,9 @@ void CanvasRenderingContext2D::strokeRect(float x, float y, float width, float h
     FloatRect boundingRect = rect;
     boundingRect.inflate(state().m_lineWidth / 2);
 
+    if (rectIsOutsideCanvas(boundingRect, state().m_globalComposite))
+        return;
+
     c->strokeRect(rect, state().m_lineWidth);
     didDraw(boundingRect);
 }
@@ -1316,7 +1324,7 @@ void CanvasRenderingContext2D::drawImage(HTMLImageElement* image, const FloatRec
         clearCanvas();
         c->drawImage(cachedImage->imageForRenderer(image->renderer()), ColorSpaceDeviceRGB, normalizedDstRect, normalizedSrcRect, op, blendMode);
         didDrawEntireCanvas();
-    } else {
+    } else if (!rectIsOutsideCanvas(normalizedDstRect, op)) {
         c->drawImage(cachedImage->imageForRenderer(image->renderer()), ColorSpaceDeviceRGB, normalizedDstRect, normalizedSrcRect, op, blendMode);
         didDraw(normalizedDstRect);
     }
@@ -1533,6 +1541,20 @@ bool CanvasRenderingContext2D::rectContainsCanvas(const FloatRect& rect) const
     return state().m_transform.mapQuad(quad).containsQuad(canvasQuad);
 }
 
+// Charts and scrolling canvases issue many draws that end up entirely off the backing store.
+// Those can be dropped, unless a shadow could still reach the canvas or the compositing
+// operator affects pixels outside the drawn area.
+bool CanvasRenderingContext2D::rectIsOutsideCanvas(const FloatRect& rect, CompositeOperator op) const
+{
+    if (shouldDrawShadows() || isFullCanvasCompositeMode(op) || op == CompositeCopy)
+        return false;
+
+    FloatRect deviceRect = state().m_transform.mapRect(rect);
+    // Leave room for antialiasing at the edges.
+    deviceRect.inflate(1);
+    return !deviceRect.intersects(FloatRect(0, 0, canvas()->width(), canvas()->height()));
+}
+
 template<class T> IntRect CanvasRenderingContext2D::calculateCompositingBufferRect(const T& area, IntSize* croppedOffset)
 {
     IntRect canvasRect(0, 0, canvas()->width(), canvas()->height());
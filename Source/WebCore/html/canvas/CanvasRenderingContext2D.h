@@ -311,6 +311,7 @@ private:
     Path transformAreaToDevice(const Path&) const;
     Path transformAreaToDevice(const FloatRect&) const;
     bool rectContainsCanvas(const FloatRect&) const;
+    bool rectIsOutsideCanvas(const FloatRect&, CompositeOperator) const;
 
     template<class T> IntRect calculateCompositingBufferRect(const T&, IntSize*);
     PassOwnPtr<ImageBuffer> createCompositingBuffer(const IntRect&);
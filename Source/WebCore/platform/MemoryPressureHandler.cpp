@@ -40,10 +40,18 @@ MemoryPressureHandler::MemoryPressureHandler()
     : m_installed(false)
     , m_lastRespondTime(0)
     , m_lowMemoryHandler(releaseMemory)
+#if OS(LINUX)
+    , m_pressureSource(NoPressureSource)
+    , m_eventFD(-1)
+    , m_criticalEventFD(-1)
+    , m_pressureLevelFD(-1)
+    , m_threadID(0)
+    , m_shouldStopMonitoring(false)
+#endif
 {
 }
 
-#if !PLATFORM(MAC) || PLATFORM(IOS) || __MAC_OS_X_VERSION_MIN_REQUIRED == 1060
+#if (!PLATFORM(MAC) || PLATFORM(IOS) || __MAC_OS_X_VERSION_MIN_REQUIRED == 1060) && !OS(LINUX)
 
 void MemoryPressureHandler::install() { }
 void MemoryPressureHandler::uninstall() { }
@@ -29,6 +29,10 @@
 #include <time.h>
 #include <wtf/FastAllocBase.h>
 
+#if OS(LINUX)
+#include <wtf/Threading.h>
+#endif
+
 namespace WebCore {
 
 typedef void (*LowMemoryHandler)(bool critical);
@@ -60,6 +64,30 @@ private:
     bool m_installed;
     time_t m_lastRespondTime;
     LowMemoryHandler m_lowMemoryHandler;
+
+#if OS(LINUX)
+    enum PressureSource { NoPressureSource, PressureStallInformation, CgroupV2MemoryEvents, CgroupV1PressureLevel };
+
+    void respondToMemoryPressure(bool critical);
+    static void monitorThreadStart(void*);
+    static void didReceiveMemoryPressureEvent(void*);
+    static void didReceiveCriticalMemoryPressureEvent(void*);
+    void waitForMemoryPressureEvents();
+    bool openPressureStallTriggers();
+    bool openCgroupV2MemoryEvents();
+    bool openCgroupV1PressureLevelEvents();
+    void closeMonitoringFileDescriptors();
+
+    PressureSource m_pressureSource;
+    // The PSI "some" trigger, cgroup v2 memory.events, or the cgroup v1 "low" eventfd.
+    int m_eventFD;
+    // The PSI "full" trigger or the cgroup v1 "critical" eventfd; unused for memory.events.
+    int m_criticalEventFD;
+    // cgroup v1 memory.pressure_level, which the eventfds are registered against.
+    int m_pressureLevelFD;
+    ThreadIdentifier m_threadID;
+    volatile bool m_shouldStopMonitoring;
+#endif
 };
  
 // Function to obtain the global memory pressure object.
@@ -255,6 +255,23 @@ inline void TimerBase::checkConsistency() const
         checkHeapIndex();
 }
 
+static inline bool parentHeapPropertyHolds(const TimerBase* current, const Vector<TimerBase*>& heap, unsigned currentIndex)
+{
+    if (!currentIndex)
+        return true;
+    unsigned parentIndex = (currentIndex - 1) / 2;
+    TimerHeapLessThanFunction compareHeapPosition;
+    return compareHeapPosition(current, heap[parentIndex]);
+}
+
+static inline bool childHeapPropertyHolds(const TimerBase* current, const Vector<TimerBase*>& heap, unsigned childIndex)
+{
+    if (childIndex >= heap.size())
+        return true;
+    TimerHeapLessThanFunction compareHeapPosition;
+    return compareHeapPosition(heap[childIndex], current);
+}
+
 void TimerBase::heapDecreaseKey()
 {
     ASSERT(m_nextFireTime != 0);
@@ -267,9 +284,24 @@ void TimerBase::heapDecreaseKey()
 inline void TimerBase::heapDelete()
 {
     ASSERT(m_nextFireTime == 0);
-    heapPop();
-    timerHeap().removeLast();
+    checkHeapIndex();
+    Vector<TimerBase*>& heap = timerHeap();
+    unsigned index = m_heapIndex;
+    TimerBase* last = heap.last();
+    heap.removeLast();
     m_heapIndex = -1;
+    if (last == this)
+        return;
+
+    // Move the last timer into the vacated slot, then sift it in whichever direction is needed.
+    heap[index] = last;
+    last->m_heapIndex = index;
+    if (last->hasValidHeapPosition())
+        return;
+    if (!parentHeapPropertyHolds(last, heap, index))
+        last->heapDecreaseKey();
+    else
+        last->heapSiftDown();
 }
 
 void TimerBase::heapDeleteMin()
@@ -283,8 +315,7 @@ void TimerBase::heapDeleteMin()
 inline void TimerBase::heapIncreaseKey()
 {
     ASSERT(m_nextFireTime != 0);
-    heapPop();
-    heapDecreaseKey();
+    heapSiftDown();
 }
 
 inline void TimerBase::heapInsert()
@@ -295,14 +326,30 @@ inline void TimerBase::heapInsert()
     heapDecreaseKey();
 }
 
-inline void TimerBase::heapPop()
+// Moves this timer towards the leaves until none of its children fires before it. This is a
+// single pass, rather than moving the timer to the top and popping it back down.
+void TimerBase::heapSiftDown()
 {
-    // Temporarily force this timer to have the minimum key so we can pop it.
-    double fireTime = m_nextFireTime;
-    m_nextFireTime = -numeric_limits<double>::infinity();
-    heapDecreaseKey();
-    heapPopMin();
-    m_nextFireTime = fireTime;
+    checkHeapIndex();
+    Vector<TimerBase*>& heap = timerHeap();
+    unsigned size = heap.size();
+    unsigned index = m_heapIndex;
+    TimerHeapLessThanFunction compareHeapPosition;
+    while (true) {
+        unsigned childIndex = 2 * index + 1;
+        if (childIndex >= size)
+            break;
+        if (childIndex + 1 < size && compareHeapPosition(heap[childIndex], heap[childIndex + 1]))
+            ++childIndex;
+        if (!compareHeapPosition(this, heap[childIndex]))
+            break;
+        heap[index] = heap[childIndex];
+        heap[index]->m_heapIndex = index;
+        index = childIndex;
+    }
+    heap[index] = this;
+    m_heapIndex = index;
+    checkHeapIndex();
 }
 
 void TimerBase::heapPopMin()
@@ -316,23 +363,6 @@ void TimerBase::heapPopMin()
     ASSERT(this == timerHeap().last());
 }
 
-static inline bool parentHeapPropertyHolds(const TimerBase* current, const Vector<TimerBase*>& heap, unsigned currentIndex)
-{
-    if (!currentIndex)
-        return true;
-    unsigned parentIndex = (currentIndex - 1) / 2;
-    TimerHeapLessThanFunction compareHeapPosition;
-    return compareHeapPosition(current, heap[parentIndex]);
-}
-
-static inline bool childHeapPropertyHolds(const TimerBase* current, const Vector<TimerBase*>& heap, unsigned childIndex)
-{
-    if (childIndex >= heap.size())
-        return true;
-    TimerHeapLessThanFunction compareHeapPosition;
-    return compareHeapPosition(heap[childIndex], current);
-}
-
 bool TimerBase::hasValidHeapPosition() const
 {
     ASSERT(m_nextFireTime);
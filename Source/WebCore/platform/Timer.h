@@ -81,8 +81,8 @@ private:
     void heapDeleteMin();
     void heapIncreaseKey();
     void heapInsert();
-    void heapPop();
     void heapPopMin();
+    void heapSiftDown();
 
     Vector<TimerBase*>& timerHeap() const { ASSERT(m_cachedThreadGlobalTimerHeap); return *m_cachedThreadGlobalTimerHeap; }
 
@@ -122,6 +122,12 @@ namespace WebCore {
         void convertToLuminanceMask();
         
         String toDataURL(const String& mimeType, const double* quality = 0, CoordinateSystem = LogicalCoordinateSystem) const;
+#if PLATFORM(QT)
+        // Encodes a snapshot of the current contents on a background thread. The callback runs on the
+        // main thread with the encoded bytes, which are empty if encoding failed.
+        typedef void (*EncodedImageCallback)(const Vector<char>& encodedData, void* context);
+        void encodeAsynchronously(const String& mimeType, const double* quality, EncodedImageCallback, void* context) const;
+#endif
 #if !USE(CG)
         AffineTransform baseTransform() const { return AffineTransform(); }
         void transformColorSpace(ColorSpace srcColorSpace, ColorSpace dstColorSpace);
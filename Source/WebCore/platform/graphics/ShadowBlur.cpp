@@ -37,6 +37,7 @@
 #include "Timer.h"
 #include <wtf/MathExtras.h>
 #include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
 
 using namespace std;
 
@@ -52,6 +53,35 @@ static inline int roundUpToMultipleOf32(int d)
     return (1 + (d >> 5)) << 5;
 }
 
+// Identifies the contents of a blurred template used by the tiled shadow paths. Two shadows
+// with the same key produce identical templates, whatever the size of the shadowed box.
+struct ShadowTemplateKey {
+    ShadowTemplateKey(bool isInset, const FloatSize& radius, const Color& color, ColorSpace colorSpace, const FloatRect& bounds, const FloatRect& shadowRect, const RoundedRect::Radii& radii)
+        : isInset(isInset)
+        , radius(radius)
+        , color(color)
+        , colorSpace(colorSpace)
+        , bounds(bounds)
+        , shadowRect(shadowRect)
+        , radii(radii)
+    {
+    }
+
+    bool operator==(const ShadowTemplateKey& other) const
+    {
+        return isInset == other.isInset && radius == other.radius && color == other.color && colorSpace == other.colorSpace
+            && bounds == other.bounds && shadowRect == other.shadowRect && radii == other.radii;
+    }
+
+    bool isInset;
+    FloatSize radius;
+    Color color;
+    ColorSpace colorSpace;
+    FloatRect bounds;
+    FloatRect shadowRect;
+    RoundedRect::Radii radii;
+};
+
 // ShadowBlur needs a scratch image as the buffer for the blur filter.
 // Instead of creating and destroying the buffer for every operation,
 // we create a buffer which will be automatically purged via a timer.
@@ -59,7 +89,8 @@ class ScratchBuffer {
     WTF_MAKE_FAST_ALLOCATED;
 public:
     ScratchBuffer()
-        : m_purgeTimer(this, &ScratchBuffer::timerFired)
+        : m_templateArea(0)
+        , m_purgeTimer(this, &ScratchBuffer::timerFired)
         , m_lastWasInset(false)
 #if !ASSERT_DISABLED
         , m_bufferInUse(false)
@@ -117,6 +148,39 @@ public:
         return true;
     }
 
+    // Returns the buffer holding the template for key, most recently used first. redrawNeeded is
+    // set when the buffer was (re)created and the caller has to draw and blur the template.
+    ImageBuffer* getTemplateBuffer(const ShadowTemplateKey& key, const IntSize& size, bool& redrawNeeded)
+    {
+        for (size_t i = 0; i < m_templates.size(); ++i) {
+            if (m_templates[i]->key == key) {
+                if (i) {
+                    OwnPtr<CachedTemplate> entry = m_templates[i].release();
+                    m_templates.remove(i);
+                    m_templates.insert(0, entry.release());
+                }
+                redrawNeeded = false;
+                return m_templates[0]->buffer.get();
+            }
+        }
+
+        redrawNeeded = true;
+        OwnPtr<ImageBuffer> buffer = ImageBuffer::create(size, 1);
+        if (!buffer)
+            return 0;
+
+        unsigned area = size.width() * size.height();
+        while (!m_templates.isEmpty() && (m_templates.size() >= maximumTemplateCount || m_templateArea + area > maximumTemplateArea)) {
+            m_templateArea -= m_templates.last()->area;
+            m_templates.removeLast();
+        }
+
+        ImageBuffer* result = buffer.get();
+        m_templates.insert(0, adoptPtr(new CachedTemplate(key, buffer.release(), area)));
+        m_templateArea += area;
+        return result;
+    }
+
     void scheduleScratchBufferPurge()
     {
 #if !ASSERT_DISABLED
@@ -141,9 +205,33 @@ private:
     {
         m_imageBuffer = nullptr;
         m_lastRadius = FloatSize();
+        m_templates.clear();
+        m_templateArea = 0;
     }
 
+    struct CachedTemplate {
+        WTF_MAKE_FAST_ALLOCATED;
+    public:
+        CachedTemplate(const ShadowTemplateKey& key, PassOwnPtr<ImageBuffer> buffer, unsigned area)
+            : key(key)
+            , buffer(buffer)
+            , area(area)
+        {
+        }
+
+        ShadowTemplateKey key;
+        OwnPtr<ImageBuffer> buffer;
+        unsigned area;
+    };
+
+    // A handful of distinct box-shadow styles covers most pages; the area bound keeps
+    // large blur radii from pinning much memory until the purge timer fires.
+    static const size_t maximumTemplateCount = 8;
+    static const unsigned maximumTemplateArea = 512 * 512;
+
     OwnPtr<ImageBuffer> m_imageBuffer;
+    Vector<OwnPtr<CachedTemplate> > m_templates;
+    unsigned m_templateArea;
     Timer<ScratchBuffer> m_purgeTimer;
     
     FloatRect m_lastInsetBounds;
@@ -674,16 +762,16 @@ void ShadowBlur::drawInsetShadowWithoutTiling(GraphicsContext* graphicsContext,
 
 void ShadowBlur::drawInsetShadowWithTiling(GraphicsContext* graphicsContext, const FloatRect& rect, const FloatRect& holeRect, const RoundedRect::Radii& radii, const IntSize& templateSize, const IntSize& edgeSize)
 {
-    m_layerImage = ScratchBuffer::shared().getScratchBuffer(templateSize);
-    if (!m_layerImage)
-        return;
-
     // Draw the rectangle with hole.
     FloatRect templateBounds(0, 0, templateSize.width(), templateSize.height());
     FloatRect templateHole = FloatRect(edgeSize.width(), edgeSize.height(), templateSize.width() - 2 * edgeSize.width(), templateSize.height() - 2 * edgeSize.height());
 
-    // Only redraw in the scratch buffer if its cached contents don't match our needs
-    bool redrawNeeded = ScratchBuffer::shared().setCachedInsetShadowValues(m_blurRadius, m_color, m_colorSpace, templateBounds, templateHole, radii);
+    // Only redraw the template if no cached one matches our needs.
+    bool redrawNeeded;
+    m_layerImage = ScratchBuffer::shared().getTemplateBuffer(ShadowTemplateKey(true, m_blurRadius, m_color, m_colorSpace, templateBounds, templateHole, radii), templateSize, redrawNeeded);
+    if (!m_layerImage)
+        return;
+
     if (redrawNeeded) {
         // Draw shadow into a new ImageBuffer.
         GraphicsContext* shadowContext = m_layerImage->context();
@@ -739,14 +827,15 @@ void ShadowBlur::drawInsetShadowWithTiling(GraphicsContext* graphicsContext, con
 
 void ShadowBlur::drawRectShadowWithTiling(GraphicsContext* graphicsContext, const FloatRect& shadowedRect, const RoundedRect::Radii& radii, const IntSize& templateSize, const IntSize& edgeSize)
 {
-    m_layerImage = ScratchBuffer::shared().getScratchBuffer(templateSize);
+    FloatRect templateBounds(0, 0, templateSize.width(), templateSize.height());
+    FloatRect templateShadow = FloatRect(edgeSize.width(), edgeSize.height(), templateSize.width() - 2 * edgeSize.width(), templateSize.height() - 2 * edgeSize.height());
+
+    // Only redraw the template if no cached one matches our needs.
+    bool redrawNeeded;
+    m_layerImage = ScratchBuffer::shared().getTemplateBuffer(ShadowTemplateKey(false, m_blurRadius, m_color, m_colorSpace, templateBounds, templateShadow, radii), templateSize, redrawNeeded);
     if (!m_layerImage)
         return;
 
-    FloatRect templateShadow = FloatRect(edgeSize.width(), edgeSize.height(), templateSize.width() - 2 * edgeSize.width(), templateSize.height() - 2 * edgeSize.height());
-
-    // Only redraw in the scratch buffer if its cached contents don't match our needs
-    bool redrawNeeded = ScratchBuffer::shared().setCachedShadowValues(m_blurRadius, m_color, m_colorSpace, templateShadow, radii, m_layerSize);
     if (redrawNeeded) {
         // Draw shadow into the ImageBuffer.
         GraphicsContext* shadowContext = m_layerImage->context();
@@ -35,11 +35,14 @@
 #include "MIMETypeRegistry.h"
 #include "StillImageQt.h"
 #include "TransparencyLayer.h"
+#include <wtf/MainThread.h>
+#include <wtf/Threading.h>
 #include <wtf/text/CString.h>
 #include <wtf/text/WTFString.h>
 
 #include <QBuffer>
 #include <QImage>
+#include <QImageIOHandler>
 #include <QImageWriter>
 #include <QPainter>
 #include <QPixmap>
@@ -130,6 +133,36 @@ void ImageBuffer::platformTransformColorSpace(const Vector<int>& lookUpTable)
     m_data.m_impl->platformTransformColorSpace(lookUpTable);
 }
 
+// Converts the premultiplied ARGB32 backing store straight into the RGBA byte order of ImageData.
+// Opaque and fully transparent pixels, which make up most canvas content, skip the division.
+template <Multiply multiplied>
+static void convertFromARGB32Premultiplied(const QImage& source, const IntRect& rect, uint8_t* destination)
+{
+    for (int y = 0; y < rect.height(); ++y) {
+        const QRgb* sourceLine = reinterpret_cast<const QRgb*>(source.constScanLine(rect.y() + y)) + rect.x();
+        for (int x = 0; x < rect.width(); ++x, destination += 4) {
+            QRgb pixel = sourceLine[x];
+            unsigned alpha = qAlpha(pixel);
+            if (multiplied == Premultiplied || alpha == 255) {
+                destination[0] = qRed(pixel);
+                destination[1] = qGreen(pixel);
+                destination[2] = qBlue(pixel);
+                destination[3] = alpha;
+            } else if (!alpha) {
+                destination[0] = 0;
+                destination[1] = 0;
+                destination[2] = 0;
+                destination[3] = 0;
+            } else {
+                destination[0] = (qRed(pixel) * 255 + alpha / 2) / alpha;
+                destination[1] = (qGreen(pixel) * 255 + alpha / 2) / alpha;
+                destination[2] = (qBlue(pixel) * 255 + alpha / 2) / alpha;
+                destination[3] = alpha;
+            }
+        }
+    }
+}
+
 template <Multiply multiplied>
 PassRefPtr<Uint8ClampedArray> getImageData(const IntRect& rect, const ImageBufferData& imageData, const IntSize& size)
 {
@@ -139,16 +172,23 @@ PassRefPtr<Uint8ClampedArray> getImageData(const IntRect& rect, const ImageBuffe
 
     RefPtr<Uint8ClampedArray> result = Uint8ClampedArray::createUninitialized(rect.width() * rect.height() * 4);
 
+    // FIXME: This is inefficient for accelerated ImageBuffers when only part of the imageData is read.
+    QImage sourceImage = imageData.m_impl->toQImage();
+    bool rectIsInside = rect.x() >= 0 && rect.y() >= 0 && rect.maxX() <= size.width() && rect.maxY() <= size.height();
+    if (rectIsInside && sourceImage.format() == QImage::Format_ARGB32_Premultiplied) {
+        convertFromARGB32Premultiplied<multiplied>(sourceImage, rect, result->data());
+        return result.release();
+    }
+
     QImage::Format format = (multiplied == Unmultiplied) ? QImage::Format_RGBA8888 : QImage::Format_RGBA8888_Premultiplied;
     QImage image(result->data(), rect.width(), rect.height(), format);
-    if (rect.x() < 0 || rect.y() < 0 || rect.maxX() > size.width() || rect.maxY() > size.height())
+    if (!rectIsInside)
         image.fill(0);
 
     // Let drawImage deal with the conversion.
-    // FIXME: This is inefficient for accelerated ImageBuffers when only part of the imageData is read.
     QPainter painter(&image);
     painter.setCompositionMode(QPainter::CompositionMode_Source);
-    painter.drawImage(QPoint(0,0), imageData.m_impl->toQImage(), rect);
+    painter.drawImage(QPoint(0,0), sourceImage, rect);
     painter.end();
 
     return result.release();
@@ -194,18 +234,38 @@ void ImageBuffer::putByteArray(Multiply multiplied, Uint8ClampedArray* source, c
         m_data.m_painter->restore();
 }
 
-static bool encodeImage(const QPixmap& pixmap, const String& format, const double* quality, QByteArray& data)
+// Deflating at zlib's default level 6 dominates the cost of encoding large canvases, while level 1
+// is several times faster for output that is typically only slightly larger.
+static const int pngCompressionLevel = 1;
+
+static int encodingQuality(const String& format, const double* quality)
 {
-    int compressionQuality = -1;
-    if (format == "jpeg" || format == "webp") {
-        compressionQuality = 100;
-        if (quality && *quality >= 0.0 && *quality <= 1.0)
-            compressionQuality = static_cast<int>(*quality * 100 + 0.5);
-    }
+    if (format != "jpeg" && format != "webp")
+        return -1;
+    if (quality && *quality >= 0.0 && *quality <= 1.0)
+        return static_cast<int>(*quality * 100 + 0.5);
+    return 100;
+}
 
+// Only touches Qt types, so that it can run on a background thread.
+static bool encodeImage(const QImage& image, const QByteArray& format, int quality, QByteArray& data)
+{
     QBuffer buffer(&data);
     buffer.open(QBuffer::WriteOnly);
-    bool success = pixmap.save(&buffer, format.utf8().data(), compressionQuality);
+
+    QImageWriter writer(&buffer, format);
+    if (quality >= 0)
+        writer.setQuality(quality);
+    else if (format == "png") {
+        if (writer.supportsOption(QImageIOHandler::CompressionRatio))
+            writer.setCompression(pngCompressionLevel);
+        else {
+            // Older PNG handlers only take the zlib level through the quality option,
+            // as level = (100 - quality) * 9 / 91.
+            writer.setQuality(100 - (pngCompressionLevel * 91 + 8) / 9);
+        }
+    }
+    bool success = writer.write(image);
     buffer.close();
 
     return success;
@@ -218,15 +278,70 @@ String ImageBuffer::toDataURL(const String& mimeType, const double* quality, Coo
     // QImageWriter does not support mimetypes. It does support Qt image formats (png,
     // gif, jpeg..., xpm) so skip the image/ to get the Qt image format used to encode
     // the m_pixmap image.
+    String format = mimeType.substring(sizeof "image");
 
-    RefPtr<Image> image = copyImage(DontCopyBackingStore);
     QByteArray data;
-    if (!encodeImage(*image->nativeImageForCurrentFrame(), mimeType.substring(sizeof "image"), quality, data))
+    if (!encodeImage(m_data.m_impl->toQImage(), format.utf8().data(), encodingQuality(format, quality), data))
         return "data:,";
 
     return "data:" + mimeType + ";base64," + data.toBase64().data();
 }
 
+struct ImageEncodingTask {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    QImage image;
+    QByteArray format;
+    int quality;
+    ImageBuffer::EncodedImageCallback callback;
+    void* context;
+    QByteArray data;
+    bool success;
+};
+
+static void didEncodeImage(void* context)
+{
+    OwnPtr<ImageEncodingTask> task = adoptPtr(static_cast<ImageEncodingTask*>(context));
+    Vector<char> data;
+    if (task->success)
+        data.append(task->data.constData(), task->data.size());
+    task->callback(data, task->context);
+}
+
+static void encodeImageOnThread(void* context)
+{
+    ImageEncodingTask* task = static_cast<ImageEncodingTask*>(context);
+    task->success = encodeImage(task->image, task->format, task->quality, task->data);
+    task->image = QImage();
+    callOnMainThread(didEncodeImage, task);
+}
+
+void ImageBuffer::encodeAsynchronously(const String& mimeType, const double* quality, EncodedImageCallback callback, void* context) const
+{
+    ASSERT(isMainThread());
+    ASSERT(MIMETypeRegistry::isSupportedImageMIMETypeForEncoding(mimeType));
+
+    String format = mimeType.substring(sizeof "image");
+
+    OwnPtr<ImageEncodingTask> task = adoptPtr(new ImageEncodingTask);
+    // toQImage() may share the backing store that later drawing goes to, so the encoder
+    // gets a deep copy of the current contents.
+    task->image = m_data.m_impl->toQImage().copy();
+    task->format = format.utf8().data();
+    task->quality = encodingQuality(format, quality);
+    task->callback = callback;
+    task->context = context;
+    task->success = false;
+
+    ThreadIdentifier threadID = createThread(encodeImageOnThread, task.get(), "WebCore: ImageEncoder");
+    if (!threadID) {
+        encodeImageOnThread(task.leakPtr());
+        return;
+    }
+    task.leakPtr();
+    detachThread(threadID);
+}
+
 PlatformLayer* ImageBuffer::platformLayer() const
 {
     return m_data.m_impl->platformLayer();
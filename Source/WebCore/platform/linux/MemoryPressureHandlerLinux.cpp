@@ -0,0 +1,387 @@
+/*
+ * Copyright (C) 2013 Digia Plc. and/or its subsidiary(-ies)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDERS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "MemoryPressureHandler.h"
+
+#if OS(LINUX)
+
+#include "CSSValuePool.h"
+#include "FontCache.h"
+#include "GCController.h"
+#include "MemoryCache.h"
+#include "PageCache.h"
+#include "StorageThread.h"
+#include "WorkerThread.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <wtf/CurrentTime.h>
+#include <wtf/FastMalloc.h>
+#include <wtf/MainThread.h>
+
+using std::max;
+
+namespace WebCore {
+
+// Same throttling as the Mac implementation: ignore further events for a minimum of
+// s_minimumHoldOffTime seconds, or s_holdOffMultiplier times the last cleanup time.
+// Critical events are not held off.
+static const unsigned s_minimumHoldOffTime = 5;
+static const unsigned s_holdOffMultiplier = 20;
+
+// The monitoring thread wakes up this often to check whether it should stop.
+static const int s_pollTimeoutMilliseconds = 1000;
+
+static double s_holdOffEndTime = 0;
+
+// Pressure stall information (Linux 4.20+) fires when tasks stall on memory for more than
+// 150ms within any one second window: "some" when at least one task stalls, "full" when
+// all non-idle tasks stall at once, which is treated as critical.
+static int openPressureStallTrigger(const char* trigger)
+{
+    int fd = open("/proc/pressure/memory", O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd == -1)
+        return -1;
+
+    if (write(fd, trigger, strlen(trigger) + 1) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Returns the memory.events file of the cgroup v2 group this process belongs to, which the
+// kernel marks as modified whenever one of its counters changes.
+static int openCgroupV2MemoryEventsFile()
+{
+    FILE* cgroupFile = fopen("/proc/self/cgroup", "re");
+    if (!cgroupFile)
+        return -1;
+
+    char line[PATH_MAX];
+    char path[PATH_MAX + 32];
+    bool found = false;
+    while (fgets(line, sizeof(line), cgroupFile)) {
+        // The unified hierarchy is the "0::<path>" entry.
+        if (strncmp(line, "0::", 3))
+            continue;
+        line[strcspn(line, "\n")] = 0;
+        const char* cgroupPath = line + 3;
+        if (!strcmp(cgroupPath, "/"))
+            cgroupPath = "";
+        found = snprintf(path, sizeof(path), "/sys/fs/cgroup%s/memory.events", cgroupPath) < static_cast<int>(sizeof(path));
+        break;
+    }
+    fclose(cgroupFile);
+
+    return found ? open(path, O_RDONLY | O_CLOEXEC) : -1;
+}
+
+struct CgroupMemoryEventCounts {
+    CgroupMemoryEventCounts()
+        : high(0)
+        , max(0)
+        , oom(0)
+    {
+    }
+
+    unsigned long long high;
+    unsigned long long max;
+    unsigned long long oom;
+};
+
+static bool readCgroupMemoryEventCounts(int fd, CgroupMemoryEventCounts& counts)
+{
+    char buffer[512];
+    ssize_t length = pread(fd, buffer, sizeof(buffer) - 1, 0);
+    if (length < 0)
+        return false;
+    buffer[length] = 0;
+
+    for (char* line = buffer; line; line = strchr(line, '\n')) {
+        if (*line == '\n')
+            ++line;
+        char name[16];
+        unsigned long long value;
+        if (sscanf(line, "%15s %llu", name, &value) != 2)
+            continue;
+        if (!strcmp(name, "high"))
+            counts.high = value;
+        else if (!strcmp(name, "max"))
+            counts.max = value;
+        else if (!strcmp(name, "oom"))
+            counts.oom = value;
+    }
+    return true;
+}
+
+// cgroup v1 memory controller: an eventfd that is signalled on pressure_level notifications
+// of the given level or above.
+static int openCgroupV1PressureLevelEvent(int pressureLevelFD, const char* level)
+{
+    int eventFD = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    int controlFD = open("/sys/fs/cgroup/memory/cgroup.event_control", O_WRONLY | O_CLOEXEC);
+    if (eventFD != -1 && controlFD != -1) {
+        char line[64];
+        int length = snprintf(line, sizeof(line), "%d %d %s", eventFD, pressureLevelFD, level);
+        if (write(controlFD, line, length + 1) >= 0) {
+            close(controlFD);
+            return eventFD;
+        }
+    }
+
+    if (controlFD != -1)
+        close(controlFD);
+    if (eventFD != -1)
+        close(eventFD);
+    return -1;
+}
+
+bool MemoryPressureHandler::openPressureStallTriggers()
+{
+    m_eventFD = openPressureStallTrigger("some 150000 1000000");
+    if (m_eventFD == -1)
+        return false;
+    m_criticalEventFD = openPressureStallTrigger("full 150000 1000000");
+    m_pressureSource = PressureStallInformation;
+    return true;
+}
+
+bool MemoryPressureHandler::openCgroupV2MemoryEvents()
+{
+    m_eventFD = openCgroupV2MemoryEventsFile();
+    if (m_eventFD == -1)
+        return false;
+    m_pressureSource = CgroupV2MemoryEvents;
+    return true;
+}
+
+bool MemoryPressureHandler::openCgroupV1PressureLevelEvents()
+{
+    m_pressureLevelFD = open("/sys/fs/cgroup/memory/memory.pressure_level", O_RDONLY | O_CLOEXEC);
+    if (m_pressureLevelFD == -1)
+        return false;
+
+    m_eventFD = openCgroupV1PressureLevelEvent(m_pressureLevelFD, "low");
+    if (m_eventFD == -1) {
+        close(m_pressureLevelFD);
+        m_pressureLevelFD = -1;
+        return false;
+    }
+    m_criticalEventFD = openCgroupV1PressureLevelEvent(m_pressureLevelFD, "critical");
+    m_pressureSource = CgroupV1PressureLevel;
+    return true;
+}
+
+void MemoryPressureHandler::install()
+{
+    if (m_installed)
+        return;
+
+    // System-wide stall information is preferred, as it measures the cost of reclaim rather
+    // than limits being hit. Without PSI, the cgroup v2 memory events of this process are
+    // used, and on cgroup v1 hosts the memory controller's pressure levels.
+    if (!openPressureStallTriggers() && !openCgroupV2MemoryEvents() && !openCgroupV1PressureLevelEvents())
+        return;
+
+    m_shouldStopMonitoring = false;
+    m_threadID = createThread(monitorThreadStart, this, "WebCore: MemoryPressure");
+    if (!m_threadID) {
+        closeMonitoringFileDescriptors();
+        return;
+    }
+
+    m_installed = true;
+}
+
+void MemoryPressureHandler::uninstall()
+{
+    if (!m_installed)
+        return;
+
+    m_shouldStopMonitoring = true;
+    waitForThreadCompletion(m_threadID);
+    m_threadID = 0;
+    closeMonitoringFileDescriptors();
+
+    m_installed = false;
+}
+
+void MemoryPressureHandler::closeMonitoringFileDescriptors()
+{
+    if (m_eventFD != -1)
+        close(m_eventFD);
+    if (m_criticalEventFD != -1)
+        close(m_criticalEventFD);
+    if (m_pressureLevelFD != -1)
+        close(m_pressureLevelFD);
+    m_eventFD = -1;
+    m_criticalEventFD = -1;
+    m_pressureLevelFD = -1;
+    m_pressureSource = NoPressureSource;
+}
+
+void MemoryPressureHandler::monitorThreadStart(void* handler)
+{
+    static_cast<MemoryPressureHandler*>(handler)->waitForMemoryPressureEvents();
+}
+
+static bool drainEventFD(int fd)
+{
+    uint64_t eventCount;
+    return read(fd, &eventCount, sizeof(eventCount)) >= 0 || errno == EAGAIN;
+}
+
+void MemoryPressureHandler::waitForMemoryPressureEvents()
+{
+    // Pressure stall triggers report POLLPRI, cgroup v1 eventfds become readable, and
+    // memory.events signals a modification with POLLPRI.
+    short events = m_pressureSource == CgroupV1PressureLevel ? POLLIN : POLLPRI;
+    struct pollfd pollFDs[2];
+    pollFDs[0].fd = m_eventFD;
+    pollFDs[0].events = events;
+    pollFDs[1].fd = m_criticalEventFD;
+    pollFDs[1].events = events;
+    nfds_t pollFDCount = m_criticalEventFD != -1 ? 2 : 1;
+
+    CgroupMemoryEventCounts lastCounts;
+    if (m_pressureSource == CgroupV2MemoryEvents && !readCgroupMemoryEventCounts(m_eventFD, lastCounts))
+        return;
+
+    while (!m_shouldStopMonitoring) {
+        pollFDs[0].revents = 0;
+        pollFDs[1].revents = 0;
+        int result = poll(pollFDs, pollFDCount, s_pollTimeoutMilliseconds);
+        if (result < 0 && errno != EINTR)
+            return;
+        if (result <= 0)
+            continue;
+        if ((pollFDs[0].revents | pollFDs[1].revents) & POLLNVAL)
+            return;
+
+        // A lower level notification is usually delivered along with the critical one.
+        bool critical = pollFDs[1].revents;
+        bool pressure = critical || pollFDs[0].revents;
+
+        switch (m_pressureSource) {
+        case CgroupV1PressureLevel:
+            if ((pollFDs[0].revents && !drainEventFD(m_eventFD)) || (pollFDs[1].revents && !drainEventFD(m_criticalEventFD)))
+                return;
+            break;
+        case CgroupV2MemoryEvents: {
+            // Reclaim above memory.high is ordinary pressure; hitting memory.max or the OOM
+            // killer is critical. Other counters, such as "low", do not indicate pressure.
+            CgroupMemoryEventCounts counts;
+            if (!readCgroupMemoryEventCounts(m_eventFD, counts))
+                return;
+            critical = counts.max != lastCounts.max || counts.oom != lastCounts.oom;
+            pressure = critical || counts.high != lastCounts.high;
+            lastCounts = counts;
+            break;
+        }
+        case PressureStallInformation:
+            if ((pollFDs[0].revents | pollFDs[1].revents) & POLLERR)
+                return;
+            break;
+        case NoPressureSource:
+            ASSERT_NOT_REACHED();
+            return;
+        }
+
+        if (pressure)
+            callOnMainThread(critical ? didReceiveCriticalMemoryPressureEvent : didReceiveMemoryPressureEvent, 0);
+    }
+}
+
+void MemoryPressureHandler::didReceiveMemoryPressureEvent(void*)
+{
+    memoryPressureHandler().respondToMemoryPressure(false);
+}
+
+void MemoryPressureHandler::didReceiveCriticalMemoryPressureEvent(void*)
+{
+    memoryPressureHandler().respondToMemoryPressure(true);
+}
+
+void MemoryPressureHandler::holdOff(unsigned seconds)
+{
+    s_holdOffEndTime = monotonicallyIncreasingTime() + seconds;
+}
+
+void MemoryPressureHandler::respondToMemoryPressure()
+{
+    respondToMemoryPressure(false);
+}
+
+void MemoryPressureHandler::respondToMemoryPressure(bool critical)
+{
+    ASSERT(isMainThread());
+
+    double startTime = monotonicallyIncreasingTime();
+    if (!critical && startTime < s_holdOffEndTime)
+        return;
+
+    m_lastRespondTime = time(0);
+    m_lowMemoryHandler(critical);
+
+    unsigned holdOffTime = (monotonicallyIncreasingTime() - startTime) * s_holdOffMultiplier;
+    holdOff(max(holdOffTime, s_minimumHoldOffTime));
+}
+
+void MemoryPressureHandler::releaseMemory(bool critical)
+{
+    int savedPageCacheCapacity = pageCache()->capacity();
+    pageCache()->setCapacity(0);
+    pageCache()->setCapacity(savedPageCacheCapacity);
+
+    fontCache()->purgeInactiveFontData();
+
+    memoryCache()->pruneToPercentage(0);
+
+    cssValuePool().drain();
+
+    gcController().discardAllCompiledCode();
+    if (critical)
+        gcController().garbageCollectNow();
+    else
+        gcController().garbageCollectSoon();
+
+    // FastMalloc has lock-free thread specific caches that can only be cleared from the thread itself.
+    StorageThread::releaseFastMallocFreeMemoryInAllThreads();
+#if ENABLE(WORKERS)
+    WorkerThread::releaseFastMallocFreeMemoryInAllThreads();
+#endif
+    WTF::releaseFastMallocFreeMemory();
+}
+
+} // namespace WebCore
+
+#endif // OS(LINUX)
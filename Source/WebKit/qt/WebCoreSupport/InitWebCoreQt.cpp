@@ -36,6 +36,7 @@
 #include "Image.h"
 #include "InitializeLogging.h"
 #include "MemoryCache.h"
+#include "MemoryPressureHandler.h"
 #include "NotImplemented.h"
 #include "Page.h"
 #include "PlatformStrategiesQt.h"
@@ -107,6 +108,8 @@ Q_DECL_EXPORT void initializeWebCoreQt()
     WebCore::RuntimeEnabledFeatures::setCSSCompositingEnabled(true);
     WebCore::Settings::setDefaultMinDOMTimerInterval(0.004);
 
+    WebCore::memoryPressureHandler().install();
+
     initialized = true;
 }
 
@@ -274,6 +274,15 @@ void QWebPageAdapter::initializeWebCorePage()
 
     page->addLayoutMilestones(DidFirstVisuallyNonEmptyLayout);
 
+    // Pages the application marks as hidden get their DOM timers aligned to
+    // Settings::hiddenPageDOMTimerAlignmentInterval() and their CSS animations suspended.
+#if ENABLE(HIDDEN_PAGE_DOM_TIMER_THROTTLING)
+    page->settings()->setHiddenPageDOMTimerThrottlingEnabled(true);
+#endif
+#if ENABLE(PAGE_VISIBILITY_API)
+    page->settings()->setHiddenPageCSSAnimationSuspensionEnabled(true);
+#endif
+
     settings = new QWebSettings(page->settings(), page->group().groupSettings());
 
 #if ENABLE(NOTIFICATIONS) || ENABLE(LEGACY_NOTIFICATIONS)
@@ -330,7 +339,21 @@ void QWebPageAdapter::setVisibilityState(VisibilityState state)
 #if ENABLE(PAGE_VISIBILITY_API)
     if (!page)
         return;
-    page->setVisibilityState(webPageVisibilityStateToWebCoreVisibilityState(state), false);
+    PageVisibilityState newState = webPageVisibilityStateToWebCoreVisibilityState(state);
+    PageVisibilityState oldState = page->visibilityState();
+    if (newState == oldState)
+        return;
+    // The page throttler also throttles requestAnimationFrame once the page has stayed hidden
+    // for a while. It has to be told first, because timers are only throttled when it agrees.
+    // It must only hear about actual transitions: throttling an already throttled page would
+    // decrement the active page count a second time.
+    bool wasHidden = oldState == PageVisibilityStateHidden;
+    bool isHidden = newState == PageVisibilityStateHidden;
+    if (isHidden && !wasHidden)
+        page->setThrottled(true);
+    page->setVisibilityState(newState, false);
+    if (wasHidden && !isHidden)
+        page->setThrottled(false);
 #else
     Q_UNUSED(state);
 #endif
@@ -54,6 +54,8 @@ private Q_SLOTS:
     void foreachManipulation();
     void emptyCollection();
     void appendCollection();
+    void repeatedFindAllAfterMutation();
+    void cloneNodeKeepsAttributeState();
     void evaluateJavaScript();
     void documentElement();
     void frame();
@@ -390,6 +392,69 @@ void tst_QWebElement::appendCollection()
     QCOMPARE(test.count(), 5);
 }
 
+void tst_QWebElement::repeatedFindAllAfterMutation()
+{
+    QString html = "<body><p class='a'>first para</p><p class='a'>second para</p><p>third para</p></body>";
+    m_mainFrame->setHtml(html);
+    QWebElement body = m_mainFrame->documentElement();
+
+    QWebElementCollection paras = body.findAll("p.a");
+    QCOMPARE(paras.count(), 2);
+    QCOMPARE(body.findAll("p.a").count(), 2);
+
+    // The results of an identical query must reflect every change to the tree in between.
+    paras.at(0).removeFromDocument();
+    QWebElementCollection afterRemoval = body.findAll("p.a");
+    QCOMPARE(afterRemoval.count(), 1);
+    QCOMPARE(afterRemoval.at(0).toPlainText(), QString("second para"));
+
+    body.findFirst("p:not(.a)").addClass("a");
+    QWebElementCollection afterClassChange = body.findAll("p.a");
+    QCOMPARE(afterClassChange.count(), 2);
+    QCOMPARE(afterClassChange.at(1).toPlainText(), QString("third para"));
+
+    body.findFirst("body").appendInside("<p class='a'>fourth para</p>");
+    QWebElementCollection afterInsertion = body.findAll("p.a");
+    QCOMPARE(afterInsertion.count(), 3);
+    QCOMPARE(afterInsertion.at(2).toPlainText(), QString("fourth para"));
+    QCOMPARE(body.findFirst("p.a").toPlainText(), QString("second para"));
+}
+
+void tst_QWebElement::cloneNodeKeepsAttributeState()
+{
+    QString html = "<head><style>.box { color: rgb(0, 128, 0); } #item { cursor: pointer; }</style></head><body></body>";
+    m_mainFrame->setHtml(html);
+    QWebElement body = m_mainFrame->findFirstElement("body");
+
+    // Clone before the source is styled, so that both elements end up sharing one attribute data object.
+    body.evaluateJavaScript(
+        "var source = document.createElement('div');"
+        "source.setAttribute('class', 'box');"
+        "source.setAttribute('id', 'item');"
+        "source.setAttribute('name', 'thing');"
+        "source.setAttribute('dir', 'rtl');"
+        "var clone = source.cloneNode(false);"
+        "source.textContent = 'source';"
+        "clone.textContent = 'clone';"
+        "this.appendChild(source);"
+        "this.appendChild(clone);");
+
+    QCOMPARE(body.findAll("div.box").count(), 2);
+    QCOMPARE(body.findAll("#item").count(), 2);
+    QCOMPARE(body.findAll("div[name=thing]").count(), 2);
+
+    QWebElementCollection divs = body.findAll("div");
+    QCOMPARE(divs.count(), 2);
+    QCOMPARE(divs.at(0).toPlainText(), QString("source"));
+    QCOMPARE(divs.at(1).toPlainText(), QString("clone"));
+    for (int i = 0; i < divs.count(); ++i) {
+        QWebElement div = divs.at(i);
+        QCOMPARE(div.styleProperty("color", QWebElement::ComputedStyle), QLatin1String("rgb(0, 128, 0)"));
+        QCOMPARE(div.styleProperty("cursor", QWebElement::ComputedStyle), QLatin1String("pointer"));
+        QCOMPARE(div.styleProperty("direction", QWebElement::ComputedStyle), QLatin1String("rtl"));
+    }
+}
+
 void tst_QWebElement::evaluateJavaScript()
 {
     QVariant result;
@@ -993,6 +993,20 @@ void WebProcess::getWebCoreStatistics(uint64_t callbackID)
     data.statisticsNumbers.set(ASCIILiteral("FastMallocReservedVMBytes"), fastMallocStatistics.reservedVMBytes);
     data.statisticsNumbers.set(ASCIILiteral("FastMallocCommittedVMBytes"), fastMallocStatistics.committedVMBytes);
     data.statisticsNumbers.set(ASCIILiteral("FastMallocFreeListBytes"), fastMallocStatistics.freeListBytes);
+
+    // Break the FastMalloc heap down by object size, skipping size classes that own no spans.
+    size_t sizeClassCount = WTF::fastMallocSizeClassStatistics(0, 0);
+    Vector<WTF::FastMallocSizeClassStatistics> sizeClassStatistics(sizeClassCount);
+    WTF::fastMallocSizeClassStatistics(sizeClassStatistics.data(), sizeClassCount);
+    for (size_t i = 0; i < sizeClassCount; ++i) {
+        const WTF::FastMallocSizeClassStatistics& sizeClass = sizeClassStatistics[i];
+        if (!sizeClass.spanBytes)
+            continue;
+        String prefix = "FastMallocSizeClass" + String::number(sizeClass.objectSize);
+        data.statisticsNumbers.set(prefix + "SpanBytes", sizeClass.spanBytes);
+        data.statisticsNumbers.set(prefix + "CentralCacheBytes", sizeClass.centralCacheBytes);
+        data.statisticsNumbers.set(prefix + "ThreadCacheBytes", sizeClass.threadCacheBytes);
+    }
     
     // Gather icon statistics.
     data.statisticsNumbers.set(ASCIILiteral("IconPageURLMappingCount"), iconDatabase().pageURLMappingCount());
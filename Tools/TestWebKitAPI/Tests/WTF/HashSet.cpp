@@ -76,4 +76,43 @@ TEST(WTF, HashSetInitialCapacity)
     generateTestCapacityUpToSize<128>();
 }
 
+// Sends every key down the same probe sequence and counts the buckets a lookup visits:
+// with safeToCompareToEmptyOrDeleted, equal() is called on each of them, deleted or not.
+struct ProbeCountingIntHash {
+    static unsigned hash(int) { return 1; }
+    static bool equal(int a, int b)
+    {
+        ++probeCount;
+        return a == b;
+    }
+    static const bool safeToCompareToEmptyOrDeleted = true;
+    static unsigned probeCount;
+};
+
+unsigned ProbeCountingIntHash::probeCount = 0;
+
+TEST(WTF, HashSetRemoveDiscardsDeletedBuckets)
+{
+    HashSet<int, ProbeCountingIntHash> testSet;
+    for (int i = 1; i <= 120; ++i)
+        testSet.add(i);
+    const int capacity = testSet.capacity();
+    ASSERT_EQ(256, capacity);
+
+    // Leaves as many deleted buckets as a quarter of the table, more than the remaining keys,
+    // without dropping below the load at which the table would shrink.
+    for (int i = 1; i <= 64; ++i)
+        testSet.remove(i);
+    ASSERT_EQ(56, testSet.size());
+    ASSERT_EQ(capacity, testSet.capacity());
+
+    for (int i = 65; i <= 120; ++i)
+        EXPECT_TRUE(testSet.contains(i));
+
+    // A miss now walks past the live keys only, not past the removed ones as well.
+    ProbeCountingIntHash::probeCount = 0;
+    EXPECT_FALSE(testSet.contains(1));
+    EXPECT_EQ(static_cast<unsigned>(testSet.size()) + 1, ProbeCountingIntHash::probeCount);
+}
+
 } // namespace TestWebKitAPI
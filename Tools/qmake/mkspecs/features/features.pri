@@ -56,6 +56,7 @@ FEATURE_DEFAULTS = \
     ENABLE_GAMEPAD=0 \
     ENABLE_GEOLOCATION=1 \
     ENABLE_GESTURE_EVENTS=1 \
+    ENABLE_HIDDEN_PAGE_DOM_TIMER_THROTTLING=1 \
     ENABLE_HIGH_DPI_CANVAS=0 \
     ENABLE_ICONDATABASE=1 \
     ENABLE_IFRAME_SEAMLESS=1 \